@@ -0,0 +1,160 @@
+#include <stdio.h>
+#include "acquisition.h"
+#include "gy33.h"
+#include "bh1750_light_sensor.h"
+#include "hardware/sync.h"
+
+static i2c_inst_t *bh1750_port;
+
+static repeating_timer_t acq_timer;
+static volatile bool running = false;
+static volatile uint32_t requested_period_us;
+static uint32_t period_us;     // Período em vigor no timer
+static uint64_t last_tick_us;  // Zero: próximo disparo não mede intervalo
+
+// Buffer circular: produtor na IRQ do timer, consumidor no loop principal
+static acq_sample_t ring[ACQ_RING_SIZE];
+static volatile uint32_t ring_head;
+static volatile uint32_t ring_tail;
+
+static acq_stats_t stats;
+
+static void acq_account_interval(uint64_t now)
+{
+    if (last_tick_us)
+    {
+        int32_t dev = (int32_t)(now - last_tick_us) - (int32_t)period_us;
+        if (dev < stats.dev_min_us)
+            stats.dev_min_us = dev;
+        if (dev > stats.dev_max_us)
+            stats.dev_max_us = dev;
+        stats.dev_abs_sum_us += dev < 0 ? -dev : dev;
+        stats.intervals++;
+        if (dev > (int32_t)(period_us / 2))
+            stats.late++;
+    }
+    last_tick_us = now;
+}
+
+static bool acq_timer_cb(repeating_timer_t *rt)
+{
+    uint64_t now = time_us_64();
+    acq_account_interval(now);
+
+    // Um sensor ausente falha na hora (sem NAK nem timeout): o outro canal
+    // mantém o período
+    acq_sample_t sample = {.t_us = now};
+    if (gy33_read_raw_crgb(&sample.c, &sample.r, &sample.g, &sample.b))
+        sample.valid |= ACQ_VALID_COLOR;
+    else
+    {
+        sample.c = sample.r = sample.g = sample.b = 0;
+        stats.no_color++;
+    }
+    if (bh1750_read_latest(bh1750_port, &sample.lux))
+        sample.valid |= ACQ_VALID_LUX;
+    else
+        stats.no_lux++;
+    stats.samples++;
+
+    uint32_t head = ring_head;
+    if (head - ring_tail >= ACQ_RING_SIZE)
+    {
+        stats.overruns++;
+    }
+    else
+    {
+        ring[head & (ACQ_RING_SIZE - 1)] = sample;
+        __dmb();
+        ring_head = head + 1;
+    }
+
+    // Novo período: o SDK reagenda com rt->delay_us após o retorno
+    uint32_t requested = requested_period_us;
+    if (requested != period_us)
+    {
+        period_us = requested;
+        rt->delay_us = -(int64_t)requested;
+    }
+    return running;
+}
+
+void acq_init(i2c_inst_t *bh1750_i2c)
+{
+    bh1750_port = bh1750_i2c;
+    acq_reset_stats();
+}
+
+bool acq_start(uint32_t period)
+{
+    if (running)
+        return true;
+
+    ring_head = ring_tail = 0;
+    last_tick_us = 0;
+    period_us = requested_period_us = period;
+    running = true;
+    // Atraso negativo: intervalo medido de início a início, sem acumular o tempo de leitura
+    if (!add_repeating_timer_us(-(int64_t)period, acq_timer_cb, NULL, &acq_timer))
+    {
+        running = false;
+        return false;
+    }
+    return true;
+}
+
+void acq_stop(void)
+{
+    if (!running)
+        return;
+    running = false;
+    cancel_repeating_timer(&acq_timer);
+}
+
+void acq_set_period_us(uint32_t period)
+{
+    requested_period_us = period;
+}
+
+uint32_t acq_get_period_us(void)
+{
+    return period_us;
+}
+
+bool acq_pop(acq_sample_t *sample)
+{
+    uint32_t tail = ring_tail;
+    if (tail == ring_head)
+        return false;
+    __dmb();
+    *sample = ring[tail & (ACQ_RING_SIZE - 1)];
+    ring_tail = tail + 1;
+    return true;
+}
+
+const acq_stats_t *acq_get_stats(void)
+{
+    return &stats;
+}
+
+void acq_reset_stats(void)
+{
+    uint32_t irq_state = save_and_disable_interrupts();
+    stats = (acq_stats_t){
+        .dev_min_us = INT32_MAX,
+        .dev_max_us = INT32_MIN,
+    };
+    restore_interrupts(irq_state);
+}
+
+void acq_report(void)
+{
+    printf("Aquisicao: %lu amostras, %lu perdidas (buffer), %lu atrasadas, periodo %lu us\n",
+           stats.samples, stats.overruns, stats.late, period_us);
+    if (stats.no_color || stats.no_lux)
+        printf("  sem dados: %lu de cor, %lu de lux\n", stats.no_color, stats.no_lux);
+    if (stats.intervals == 0)
+        return;
+    printf("  desvio do periodo min %ld us  max %ld us  medio |%llu| us\n",
+           stats.dev_min_us, stats.dev_max_us, stats.dev_abs_sum_us / stats.intervals);
+}
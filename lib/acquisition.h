@@ -0,0 +1,87 @@
+#ifndef ACQUISITION_H
+#define ACQUISITION_H
+
+#include "pico/stdlib.h"
+#include "hardware/i2c.h"
+
+/**
+ * @brief Aquisição a taxa fixa disparada por timer de hardware.
+ *
+ * Um repeating timer (agendamento início-a-início) lê o GY-33 e o BH1750
+ * na própria interrupção e grava a amostra, com o instante da leitura, num
+ * buffer circular. O loop principal só consome o buffer: display, matriz e
+ * buzzer não alteram o espaçamento das amostras.
+ *
+ * Enquanto a aquisição está ativa o i2c0 pertence à interrupção.
+ */
+
+// Capacidade do buffer circular (potência de 2)
+#define ACQ_RING_SIZE 64
+
+// Canais presentes numa amostra: sensor ausente = canal sem dados (valores zerados)
+#define ACQ_VALID_COLOR 0x01
+#define ACQ_VALID_LUX 0x02
+
+typedef struct
+{
+    uint64_t t_us;       // Instante da leitura (64 bits: não dá a volta)
+    uint16_t c, r, g, b; // Contagens brutas do GY-33
+    uint16_t lux;
+    uint8_t valid;       // ACQ_VALID_*
+} acq_sample_t;
+
+typedef struct
+{
+    uint32_t samples;
+    uint32_t overruns; // Amostras perdidas com o buffer cheio
+    uint32_t no_color; // Amostras sem o GY-33
+    uint32_t no_lux;   // Amostras sem o BH1750
+    uint32_t late;     // Intervalos acima de 1.5x o período (períodos perdidos)
+    // Desvio do intervalo real em relação ao período configurado
+    int32_t dev_min_us;
+    int32_t dev_max_us;
+    uint64_t dev_abs_sum_us;
+    // Intervalos medidos (o primeiro disparo após acq_start não mede). Depois de
+    // uma troca de período o timer reagenda com o novo valor, então o intervalo
+    // seguinte já é comparado com ele
+    uint32_t intervals;
+} acq_stats_t;
+
+/**
+ * @brief Define o barramento do BH1750 (o GY-33 usa o transporte configurado no driver).
+ */
+void acq_init(i2c_inst_t *bh1750_i2c);
+
+/**
+ * @brief Inicia a aquisição com o período dado, esvaziando o buffer.
+ */
+bool acq_start(uint32_t period_us);
+
+/**
+ * @brief Para a aquisição; o barramento volta ao loop principal.
+ */
+void acq_stop(void);
+
+/**
+ * @brief Troca o período; aplicado pelo próprio timer no próximo disparo.
+ */
+void acq_set_period_us(uint32_t period_us);
+
+uint32_t acq_get_period_us(void);
+
+/**
+ * @brief Retira a amostra mais antiga do buffer.
+ *
+ * @return false se o buffer está vazio.
+ */
+bool acq_pop(acq_sample_t *sample);
+
+const acq_stats_t *acq_get_stats(void);
+void acq_reset_stats(void);
+
+/**
+ * @brief Imprime amostras, perdas, atrasos e jitter do período.
+ */
+void acq_report(void);
+
+#endif // ACQUISITION_H
@@ -0,0 +1,76 @@
+#include "adaptive_rate.h"
+
+// Parâmetros padrão do modelo de ruído
+#define ADAPT_DEFAULT_K 4
+#define ADAPT_DEFAULT_FLOOR 2
+#define ADAPT_DEFAULT_STABLE 8
+#define ADAPT_NOISE_SHIFT 3 // Ruído acompanha |delta| com alfa = 1/8
+
+void adaptive_rate_init(adaptive_rate_t *ar, uint32_t min_period_ms, uint32_t max_period_ms)
+{
+    ar->min_period_ms = min_period_ms;
+    ar->max_period_ms = max_period_ms;
+    ar->k = ADAPT_DEFAULT_K;
+    ar->floor = ADAPT_DEFAULT_FLOOR;
+    ar->stable_needed = ADAPT_DEFAULT_STABLE;
+    adaptive_rate_reset(ar);
+}
+
+void adaptive_rate_reset(adaptive_rate_t *ar)
+{
+    ar->period_ms = ar->min_period_ms;
+    ar->stable_count = 0;
+    ar->primed = false;
+    for (int i = 0; i < ADAPT_CHANNELS; i++)
+        ar->noise_q4[i] = ar->floor << 4;
+}
+
+bool adaptive_rate_update(adaptive_rate_t *ar, const int32_t samples[ADAPT_CHANNELS])
+{
+    bool changed = false;
+
+    if (ar->primed)
+    {
+        for (int i = 0; i < ADAPT_CHANNELS; i++)
+        {
+            int32_t delta = samples[i] - ar->last[i];
+            if (delta < 0)
+                delta = -delta;
+
+            int32_t threshold_q4 = ar->k * ar->noise_q4[i];
+            if (threshold_q4 < (ar->floor << 4))
+                threshold_q4 = ar->floor << 4;
+
+            if ((delta << 4) > threshold_q4)
+            {
+                changed = true;
+            }
+            else
+            {
+                // Só variações compatíveis com ruído alimentam o modelo de ruído
+                ar->noise_q4[i] += ((delta << 4) - ar->noise_q4[i]) >> ADAPT_NOISE_SHIFT;
+            }
+        }
+    }
+
+    for (int i = 0; i < ADAPT_CHANNELS; i++)
+        ar->last[i] = samples[i];
+    ar->primed = true;
+
+    if (changed)
+    {
+        // Reação rápida: vai direto para a taxa máxima
+        ar->period_ms = ar->min_period_ms;
+        ar->stable_count = 0;
+    }
+    else if (++ar->stable_count >= ar->stable_needed)
+    {
+        // Cena estável: recua pela metade da taxa
+        ar->stable_count = 0;
+        ar->period_ms *= 2;
+        if (ar->period_ms > ar->max_period_ms)
+            ar->period_ms = ar->max_period_ms;
+    }
+
+    return changed;
+}
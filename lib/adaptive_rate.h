@@ -0,0 +1,50 @@
+#ifndef ADAPTIVE_RATE_H
+#define ADAPTIVE_RATE_H
+
+#include "pico/stdlib.h"
+
+// Canais observados (R, G, B, lux)
+#define ADAPT_CHANNELS 4
+
+/**
+ * @brief Controlador de taxa de aquisição guiado por detecção de mudança.
+ *
+ * Cada canal mantém uma estimativa de ruído (média exponencial de |delta|
+ * entre amostras estáveis). Uma variação acima de k vezes o ruído é mudança
+ * de cena: o período cai imediatamente para o mínimo. Após várias amostras
+ * estáveis seguidas, o período dobra até o máximo.
+ */
+typedef struct
+{
+    uint32_t min_period_ms;
+    uint32_t max_period_ms;
+    uint32_t period_ms;                // Período atual
+    uint8_t k;                         // Multiplicador do ruído para detectar mudança
+    uint8_t floor;                     // Limiar mínimo absoluto (contagens)
+    uint8_t stable_needed;             // Amostras estáveis antes de desacelerar
+    uint8_t stable_count;
+    bool primed;                       // Já existe uma amostra anterior
+    int32_t last[ADAPT_CHANNELS];
+    int32_t noise_q4[ADAPT_CHANNELS];  // Ruído estimado, escala x16
+} adaptive_rate_t;
+
+/**
+ * @brief Inicializa o controlador começando no período mínimo.
+ */
+void adaptive_rate_init(adaptive_rate_t *ar, uint32_t min_period_ms, uint32_t max_period_ms);
+
+/**
+ * @brief Esquece a cena anterior (ex.: após recalibrar) e volta ao período mínimo.
+ */
+void adaptive_rate_reset(adaptive_rate_t *ar);
+
+/**
+ * @brief Alimenta o controlador com uma amostra e ajusta period_ms
+ *        (aplicado pelo timer da aquisição).
+ *
+ * @param samples ADAPT_CHANNELS valores da amostra atual.
+ * @return true se a amostra foi classificada como mudança de cena.
+ */
+bool adaptive_rate_update(adaptive_rate_t *ar, const int32_t samples[ADAPT_CHANNELS]);
+
+#endif // ADAPTIVE_RATE_H
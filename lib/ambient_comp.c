@@ -0,0 +1,87 @@
+#include "ambient_comp.h"
+
+// Variação relativa (1/16 = ~6%) a partir da qual lux e clear precisam concordar
+#define AMB_AGREE_SHIFT 4
+
+void ambient_comp_init(ambient_comp_t *ac, uint8_t shift)
+{
+    if (shift < 1)
+        shift = 1;
+    if (shift > 8)
+        shift = 8;
+    ac->shift = shift;
+    ac->calibrated = false;
+    ac->gain_q16 = AMB_GAIN_ONE;
+    ambient_comp_reset(ac);
+}
+
+void ambient_comp_calibrate(ambient_comp_t *ac, uint16_t lux)
+{
+    ac->ref_lux = lux;
+    ac->calibrated = (lux >= AMB_MIN_LUX);
+    ac->gain_q16 = AMB_GAIN_ONE;
+    ambient_comp_reset(ac);
+}
+
+void ambient_comp_reset(ambient_comp_t *ac)
+{
+    ac->primed = false;
+}
+
+// Sinal de uma variação, ignorando as menores que 1/2^AMB_AGREE_SHIFT do valor
+static int amb_direction(uint32_t prev, uint32_t now)
+{
+    uint32_t band = prev >> AMB_AGREE_SHIFT;
+    if (now > prev + band)
+        return 1;
+    if (now + band < prev)
+        return -1;
+    return 0;
+}
+
+int32_t ambient_comp_update(ambient_comp_t *ac, uint16_t lux, uint16_t clear)
+{
+    if (!ac->calibrated || lux < AMB_MIN_LUX)
+        return ac->gain_q16;
+
+    if (!ac->primed)
+    {
+        ac->lux_q4 = lux << 4;
+        ac->clear_q4 = clear << 4;
+    }
+    else
+    {
+        uint32_t prev_lux = ac->lux_q4;
+        uint32_t prev_clear = ac->clear_q4;
+        // Mesmo EMA rápido (alfa = 1/4) nas duas entradas para compará-las
+        ac->lux_q4 += ((int32_t)(lux << 4) - (int32_t)ac->lux_q4) >> 2;
+        ac->clear_q4 += ((int32_t)(clear << 4) - (int32_t)ac->clear_q4) >> 2;
+
+        int d_lux = amb_direction(prev_lux, ac->lux_q4);
+        int d_clear = amb_direction(prev_clear, ac->clear_q4);
+        if (d_lux * d_clear < 0)
+            return ac->gain_q16; // Sensores discordam: mantém o ganho
+    }
+
+    int64_t target = ((uint64_t)ac->ref_lux << 20) / ac->lux_q4; // (ref * 16 / lux_q4) em Q16
+    if (target < AMB_GAIN_MIN)
+        target = AMB_GAIN_MIN;
+    if (target > AMB_GAIN_MAX)
+        target = AMB_GAIN_MAX;
+
+    if (!ac->primed)
+    {
+        ac->gain_q16 = target;
+        ac->primed = true;
+    }
+    else
+    {
+        ac->gain_q16 += ((int32_t)target - ac->gain_q16) >> ac->shift;
+    }
+    return ac->gain_q16;
+}
+
+float ambient_comp_gain(const ambient_comp_t *ac)
+{
+    return ac->gain_q16 / (float)AMB_GAIN_ONE;
+}
@@ -0,0 +1,59 @@
+#ifndef AMBIENT_COMP_H
+#define AMBIENT_COMP_H
+
+#include "pico/stdlib.h"
+
+// Ganho em ponto fixo Q16 (65536 = 1.0)
+#define AMB_GAIN_ONE 65536
+#define AMB_GAIN_MIN (AMB_GAIN_ONE / 4)
+#define AMB_GAIN_MAX (AMB_GAIN_ONE * 4)
+
+// Abaixo disso o BH1750 é dominado por ruído: o ganho fica congelado
+#define AMB_MIN_LUX 5
+
+/**
+ * @brief Compensação da luz ambiente sobre a cor calibrada.
+ *
+ * Na calibração do branco guarda-se o lux do BH1750. Depois, o ganho segue lux_ref / lux_atual por uma média
+ * exponencial, de modo que uma mudança de iluminação é absorvida em
+ * poucas amostras sem recalibrar. O canal clear serve de confirmação:
+ * se lux e clear mudam em sentidos opostos (sombra só sobre um dos
+ * sensores, ou troca do objeto medido) o ganho não é atualizado.
+ */
+typedef struct
+{
+    uint32_t ref_lux;
+    uint32_t lux_q4;   // Lux filtrado, escala x16
+    uint32_t clear_q4; // Clear filtrado, escala x16
+    int32_t gain_q16;
+    uint8_t shift;     // Constante da média exponencial do ganho (alfa = 1/2^shift)
+    bool calibrated;
+    bool primed;
+} ambient_comp_t;
+
+/**
+ * @brief Inicializa com ganho unitário e sem referência.
+ */
+void ambient_comp_init(ambient_comp_t *ac, uint8_t shift);
+
+/**
+ * @brief Registra a iluminação de referência (chamado junto da calibração do branco).
+ */
+void ambient_comp_calibrate(ambient_comp_t *ac, uint16_t lux);
+
+/**
+ * @brief Recomeça a estimativa (o ganho salta para o valor atual na próxima amostra).
+ */
+void ambient_comp_reset(ambient_comp_t *ac);
+
+/**
+ * @brief Alimenta uma amostra de lux e clear e devolve o ganho em Q16.
+ */
+int32_t ambient_comp_update(ambient_comp_t *ac, uint16_t lux, uint16_t clear);
+
+/**
+ * @brief Ganho atual como float, no formato aceito por gy33_set_ambient_gain.
+ */
+float ambient_comp_gain(const ambient_comp_t *ac);
+
+#endif // AMBIENT_COMP_H
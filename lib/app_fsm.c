@@ -0,0 +1,96 @@
+#include <stdio.h>
+#include "app_fsm.h"
+
+void app_fsm_init(app_fsm_t *fsm, const app_state_t *states, uint8_t num_states,
+                  const app_transition_t *transitions, uint8_t num_transitions,
+                  uint8_t initial, uint queue_len, app_fsm_subsys_t subsys)
+{
+    fsm->states = states;
+    fsm->num_states = num_states;
+    fsm->transitions = transitions;
+    fsm->num_transitions = num_transitions;
+    fsm->subsys = subsys;
+    fsm->current = initial;
+    fsm->started = false;
+    fsm->dropped = 0;
+    fsm->unhandled = 0;
+    queue_init(&fsm->queue, sizeof(app_event_t), queue_len);
+}
+
+bool app_fsm_post(app_fsm_t *fsm, uint8_t type, uint32_t arg)
+{
+    app_event_t ev = {.type = type, .arg = arg};
+    if (queue_try_add(&fsm->queue, &ev))
+        return true;
+    fsm->dropped++;
+    return false;
+}
+
+void app_fsm_goto(app_fsm_t *fsm, uint8_t state)
+{
+    if (state >= fsm->num_states)
+        return;
+
+    const app_state_t *from = &fsm->states[fsm->current];
+    const app_state_t *to = &fsm->states[state];
+
+    printf("STATE %s -> %s\n", from->name, to->name);
+    if (from->on_exit)
+        from->on_exit(fsm);
+
+    uint32_t stop = from->subsystems & ~to->subsystems;
+    if (stop && fsm->subsys)
+        fsm->subsys(stop, false);
+
+    fsm->current = state;
+    if (to->on_entry)
+        to->on_entry(fsm);
+
+    uint32_t start = to->subsystems & ~from->subsystems;
+    if (start && fsm->subsys)
+        fsm->subsys(start, true);
+}
+
+static const app_transition_t *find_transition(const app_fsm_t *fsm, uint8_t event)
+{
+    for (uint8_t i = 0; i < fsm->num_transitions; i++)
+    {
+        const app_transition_t *t = &fsm->transitions[i];
+        if (t->event == event && (t->from == fsm->current || t->from == APP_FSM_ANY))
+            return t;
+    }
+    return NULL;
+}
+
+void app_fsm_dispatch(app_fsm_t *fsm)
+{
+    if (!fsm->started)
+    {
+        // Entrada no estado inicial, com os subsistemas dele
+        fsm->started = true;
+        const app_state_t *s = &fsm->states[fsm->current];
+        if (s->on_entry)
+            s->on_entry(fsm);
+        if (s->subsystems && fsm->subsys)
+            fsm->subsys(s->subsystems, true);
+    }
+
+    app_event_t ev;
+    while (queue_try_remove(&fsm->queue, &ev))
+    {
+        const app_transition_t *t = find_transition(fsm, ev.type);
+        if (!t)
+        {
+            fsm->unhandled++;
+            continue;
+        }
+        if (t->action)
+            t->action(fsm, &ev);
+        if (t->to != APP_FSM_STAY && t->to != fsm->current)
+            app_fsm_goto(fsm, t->to);
+    }
+
+    const app_state_t *s = &fsm->states[fsm->current];
+    if (s->on_tick)
+        s->on_tick(fsm);
+}
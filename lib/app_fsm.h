@@ -0,0 +1,111 @@
+#ifndef APP_FSM_H
+#define APP_FSM_H
+
+#include "pico/stdlib.h"
+#include "pico/util/queue.h"
+
+/**
+ * @brief Máquina de estados dirigida por tabela, com fila de eventos.
+ *
+ * Interrupções (botões, timers) e o console só postam eventos na fila;
+ * transições, handlers de entrada/saída e o tick rodam todos na thread do
+ * loop principal, dentro de app_fsm_dispatch(). Nenhum estado é alterado
+ * em contexto de IRQ.
+ *
+ * Cada estado declara a máscara de subsistemas que ficam ativos nele. Na
+ * troca de estado a ordem é: saída do estado antigo, desligamento dos
+ * subsistemas que deixam de valer, entrada do novo estado e, por último,
+ * ligação dos subsistemas novos (o estado se prepara antes de eles rodarem).
+ */
+
+#define APP_FSM_ANY 0xFF  // Curinga de estado de origem na tabela de transições
+#define APP_FSM_STAY 0xFF // Destino: permanece no estado (só executa a ação)
+
+typedef struct
+{
+    uint8_t type;
+    uint32_t arg;
+} app_event_t;
+
+typedef struct app_fsm app_fsm_t;
+
+typedef void (*app_fsm_handler_t)(app_fsm_t *fsm);
+typedef void (*app_fsm_action_t)(app_fsm_t *fsm, const app_event_t *ev);
+typedef void (*app_fsm_subsys_t)(uint32_t mask, bool enable);
+
+typedef struct
+{
+    const char *name;
+    uint32_t subsystems;        // Subsistemas que rodam neste estado
+    app_fsm_handler_t on_entry; // Opcionais (NULL)
+    app_fsm_handler_t on_exit;
+    app_fsm_handler_t on_tick; // Uma vez por volta do loop, após os eventos
+} app_state_t;
+
+// Linha da tabela: a primeira que casar (estado, evento) é usada
+typedef struct
+{
+    uint8_t from;            // Estado de origem ou APP_FSM_ANY
+    uint8_t event;
+    uint8_t to;              // Estado de destino ou APP_FSM_STAY
+    app_fsm_action_t action; // Executada antes da saída do estado (opcional)
+} app_transition_t;
+
+struct app_fsm
+{
+    const app_state_t *states;
+    uint8_t num_states;
+    const app_transition_t *transitions;
+    uint8_t num_transitions;
+    app_fsm_subsys_t subsys; // Liga/desliga subsistemas pela máscara
+    volatile uint8_t current;
+    bool started;
+    queue_t queue;
+    volatile uint32_t dropped;   // Eventos perdidos com a fila cheia
+    uint32_t unhandled;          // Eventos sem transição no estado atual
+};
+
+/**
+ * @brief Prepara a máquina sem entrar no estado inicial.
+ *
+ * @param queue_len Capacidade da fila de eventos.
+ * @param subsys Callback de subsistemas (pode ser NULL).
+ */
+void app_fsm_init(app_fsm_t *fsm, const app_state_t *states, uint8_t num_states,
+                  const app_transition_t *transitions, uint8_t num_transitions,
+                  uint8_t initial, uint queue_len, app_fsm_subsys_t subsys);
+
+/**
+ * @brief Posta um evento. Segura em IRQ e no outro núcleo; nunca bloqueia.
+ *
+ * @return false se a fila estava cheia (evento contado como perdido).
+ */
+bool app_fsm_post(app_fsm_t *fsm, uint8_t type, uint32_t arg);
+
+/**
+ * @brief Entra no estado inicial (na primeira chamada), consome todos os
+ *        eventos pendentes e executa o tick do estado atual.
+ */
+void app_fsm_dispatch(app_fsm_t *fsm);
+
+/**
+ * @brief Força uma transição a partir da thread do loop (mesma ordem da tabela).
+ */
+void app_fsm_goto(app_fsm_t *fsm, uint8_t state);
+
+static inline uint8_t app_fsm_current(const app_fsm_t *fsm)
+{
+    return fsm->current;
+}
+
+static inline uint32_t app_fsm_subsystems(const app_fsm_t *fsm)
+{
+    return fsm->states[fsm->current].subsystems;
+}
+
+static inline bool app_fsm_running(const app_fsm_t *fsm, uint32_t mask)
+{
+    return (app_fsm_subsystems(fsm) & mask) != 0;
+}
+
+#endif // APP_FSM_H
@@ -0,0 +1,111 @@
+#include "assets.h"
+
+// Posição de escrita no fluxo decodificado
+typedef struct
+{
+    ssd1306_t *ssd;
+    int16_t x;      // Coluna do asset na tela
+    uint8_t page;   // Página da tela onde começa o asset
+    uint8_t shift;  // Deslocamento de y dentro da página
+    uint8_t width;
+    uint8_t col;    // Próxima coluna da página atual do asset
+    uint8_t k;      // Página atual do asset
+} asset_cursor_t;
+
+// Escreve um byte na coluna sx da página k do asset (sx já recortado)
+static inline void asset_put(const asset_cursor_t *c, uint8_t *dst, uint8_t p, uint8_t byte)
+{
+    uint8_t pages = c->ssd->pages;
+    if (c->shift == 0)
+    {
+        dst[p] = byte;
+        return;
+    }
+    uint8_t low_mask = 0xFF << c->shift;
+    dst[p] = (dst[p] & ~low_mask) | (uint8_t)(byte << c->shift);
+    if (p + 1 < pages)
+    {
+        uint8_t high_mask = 0xFF >> (8 - c->shift);
+        dst[p + 1] = (dst[p + 1] & ~high_mask) | (byte >> (8 - c->shift));
+    }
+}
+
+// Emite n bytes (literais de 'lit' ou repetições de 'fill'), quebrando nas
+// bordas das páginas do asset. Retorna false quando o resto fica abaixo da tela.
+static bool asset_span(asset_cursor_t *c, const uint8_t *lit, uint8_t fill, uint16_t n)
+{
+    ssd1306_t *ssd = c->ssd;
+    while (n > 0)
+    {
+        uint8_t p = c->page + c->k;
+        if (p >= ssd->pages)
+            return false;
+
+        uint16_t span = c->width - c->col;
+        if (span > n)
+            span = n;
+
+        // Recorte horizontal do trecho [col, col + span)
+        int16_t sx0 = c->x + c->col;
+        uint16_t i0 = sx0 < 0 ? -sx0 : 0;
+        int16_t room = ssd->width - sx0;
+        uint16_t i1 = room < 0 ? 0 : (room < (int16_t)span ? room : span);
+        for (uint16_t i = i0; i < i1; i++)
+        {
+            uint8_t *dst = &ssd->ram_buffer[1 + (sx0 + i) * ssd->pages];
+            asset_put(c, dst, p, lit ? lit[i] : fill);
+        }
+
+        if (lit)
+            lit += span;
+        n -= span;
+        c->col += span;
+        if (c->col == c->width)
+        {
+            c->col = 0;
+            c->k++;
+        }
+    }
+    return true;
+}
+
+void asset_draw(ssd1306_t *ssd, const asset_t *asset, int16_t x, uint8_t y)
+{
+    if (x >= ssd->width || x + asset->width <= 0 || (y >> 3) >= ssd->pages)
+        return;
+
+    asset_cursor_t c = {
+        .ssd = ssd,
+        .x = x,
+        .page = y >> 3,
+        .shift = y & 0b111,
+        .width = asset->width,
+        .col = 0,
+        .k = 0,
+    };
+
+    const uint8_t *src = asset->data;
+    const uint8_t *end = src + asset->size;
+    if (!(asset->flags & ASSET_RLE))
+    {
+        asset_span(&c, src, 0, asset->size);
+        return;
+    }
+
+    while (src < end)
+    {
+        uint8_t n = *src++;
+        bool more;
+        if (n < 128)
+        {
+            more = asset_span(&c, src, 0, n + 1);
+            src += n + 1;
+        }
+        else
+        {
+            more = asset_span(&c, NULL, *src++, n - 126);
+        }
+        if (!more)
+            break;
+    }
+}
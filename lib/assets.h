@@ -0,0 +1,59 @@
+#ifndef ASSETS_H
+#define ASSETS_H
+
+#include "pico/stdlib.h"
+#include "ssd1306.h"
+
+/**
+ * @brief Imagem monocromática residente em flash (ícones, unidades, splash).
+ *
+ * Os pixels vêm em bytes de página (8 linhas por byte, bit 0 no topo), uma
+ * página de 'width' bytes após a outra - o formato de ssd1306_draw_bitmap.
+ * Com ASSET_RLE o fluxo é comprimido com PackBits:
+ *   n = 0..127   -> n + 1 bytes literais a seguir
+ *   n = 128..255 -> o próximo byte repetido n - 126 vezes
+ * Gerados por tools/img2asset.py a partir de assets/ (ver lib/assets_data.c).
+ */
+typedef struct
+{
+    uint8_t width;       // Largura em pixels (colunas)
+    uint8_t pages;       // Altura em páginas (8 pixels cada)
+    uint8_t flags;       // ASSET_RLE
+    uint16_t size;       // Bytes em 'data'
+    const uint8_t *data;
+} asset_t;
+
+#define ASSET_RLE 0x01
+
+// Alertas (16x16)
+extern const asset_t asset_icon_alert;
+extern const asset_t asset_icon_color;
+extern const asset_t asset_icon_low_light;
+extern const asset_t asset_icon_drift;
+// Modos (16x16)
+extern const asset_t asset_icon_sun;
+extern const asset_t asset_icon_dark;
+extern const asset_t asset_icon_trigger;
+extern const asset_t asset_icon_usb;
+// Unidades e estado dos sensores (8 px de altura)
+extern const asset_t asset_unit_lux;
+extern const asset_t asset_status_ok;
+extern const asset_t asset_status_missing;
+// Tela de boot (128x64)
+extern const asset_t asset_splash;
+
+/**
+ * @brief Decodifica o asset direto no ram_buffer, sem buffer intermediário.
+ *
+ * Os bytes substituem o conteúdo do retângulo (desenho opaco). Em y alinhado
+ * a página são cópias de bytes inteiros; fora do alinhamento cada byte é
+ * dividido entre duas páginas com máscara. Colunas e páginas fora da tela
+ * são recortadas; a decodificação para na primeira página abaixo da tela.
+ * Não envia nada ao display.
+ *
+ * @param x Coluna da borda esquerda (pode ser negativa).
+ * @param y Linha da borda superior.
+ */
+void asset_draw(ssd1306_t *ssd, const asset_t *asset, int16_t x, uint8_t y);
+
+#endif // ASSETS_H
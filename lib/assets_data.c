@@ -0,0 +1,197 @@
+// Gerado por tools/img2asset.py a partir de assets/ - não editar à mão.
+// Bytes de página ('width' bytes por página, bit 0 no topo), RLE PackBits.
+
+#include "assets.h"
+
+// icon_alert.pbm: 16x16, 32 -> 32 bytes
+static const uint8_t asset_icon_alert_data[] = {
+    0x00, 0x00, 0x00, 0x80, 0xE0, 0x38, 0x0E, 0xF3, 0xF3, 0x0E, 0x38, 0xE0, 0x80, 0x00, 0x00, 0x00,
+    0x60, 0x78, 0x4E, 0x43, 0x40, 0x40, 0x40, 0x5B, 0x5B, 0x40, 0x40, 0x40, 0x43, 0x4E, 0x78, 0x60,
+};
+
+const asset_t asset_icon_alert = {
+    .width = 16,
+    .pages = 2,
+    .flags = 0,
+    .size = 32,
+    .data = asset_icon_alert_data,
+};
+
+// icon_color.pbm: 16x16, 32 -> 31 bytes
+static const uint8_t asset_icon_color_data[] = {
+    0x81, 0x00, 0x03, 0xC0, 0x20, 0x98, 0x06, 0x80, 0x01, 0x03, 0x06, 0x18, 0x20, 0xC0, 0x83, 0x00,
+    0x03, 0x0F, 0x10, 0x27, 0x48, 0x80, 0x50, 0x81, 0x40, 0x02, 0x20, 0x10, 0x0F, 0x80, 0x00,
+};
+
+const asset_t asset_icon_color = {
+    .width = 16,
+    .pages = 2,
+    .flags = ASSET_RLE,
+    .size = 31,
+    .data = asset_icon_color_data,
+};
+
+// icon_dark.pbm: 16x16, 32 -> 10 bytes
+static const uint8_t asset_icon_dark_data[] = {
+    0x00, 0x00, 0x8C, 0xFE, 0x80, 0x00, 0x8C, 0x7F, 0x00, 0x00,
+};
+
+const asset_t asset_icon_dark = {
+    .width = 16,
+    .pages = 2,
+    .flags = ASSET_RLE,
+    .size = 10,
+    .data = asset_icon_dark_data,
+};
+
+// icon_drift.pbm: 16x16, 32 -> 27 bytes
+static const uint8_t asset_icon_drift_data[] = {
+    0x03, 0xFE, 0x00, 0x40, 0x80, 0x82, 0x00, 0x08, 0x80, 0x40, 0x20, 0x14, 0x0C, 0x1C, 0x3C, 0x00,
+    0x3F, 0x81, 0x20, 0x00, 0x21, 0x80, 0x22, 0x00, 0x21, 0x86, 0x20,
+};
+
+const asset_t asset_icon_drift = {
+    .width = 16,
+    .pages = 2,
+    .flags = ASSET_RLE,
+    .size = 27,
+    .data = asset_icon_drift_data,
+};
+
+// icon_low_light.pbm: 16x16, 32 -> 26 bytes
+static const uint8_t asset_icon_low_light_data[] = {
+    0x80, 0x00, 0x01, 0x78, 0x84, 0x80, 0x02, 0x82, 0x01, 0x80, 0x02, 0x01, 0x84, 0x78, 0x84, 0x00,
+    0x01, 0x01, 0x3E, 0x82, 0x54, 0x01, 0x3E, 0x01, 0x82, 0x00,
+};
+
+const asset_t asset_icon_low_light = {
+    .width = 16,
+    .pages = 2,
+    .flags = ASSET_RLE,
+    .size = 26,
+    .data = asset_icon_low_light_data,
+};
+
+// icon_sun.pbm: 16x16, 32 -> 32 bytes
+static const uint8_t asset_icon_sun_data[] = {
+    0x80, 0x80, 0x84, 0x08, 0xC0, 0xE0, 0xF0, 0xF7, 0xF0, 0xE0, 0xC0, 0x08, 0x84, 0x80, 0x80, 0x00,
+    0x00, 0x00, 0x10, 0x08, 0x01, 0x03, 0x07, 0x77, 0x07, 0x03, 0x01, 0x08, 0x10, 0x00, 0x00, 0x00,
+};
+
+const asset_t asset_icon_sun = {
+    .width = 16,
+    .pages = 2,
+    .flags = 0,
+    .size = 32,
+    .data = asset_icon_sun_data,
+};
+
+// icon_trigger.pbm: 16x16, 32 -> 28 bytes
+static const uint8_t asset_icon_trigger_data[] = {
+    0x81, 0x00, 0x0A, 0x40, 0x60, 0x70, 0x78, 0xFC, 0xFE, 0xEF, 0xE7, 0x63, 0x61, 0x20, 0x82, 0x00,
+    0x04, 0x10, 0x08, 0x0C, 0x06, 0x07, 0x80, 0x03, 0x00, 0x01, 0x84, 0x00,
+};
+
+const asset_t asset_icon_trigger = {
+    .width = 16,
+    .pages = 2,
+    .flags = ASSET_RLE,
+    .size = 28,
+    .data = asset_icon_trigger_data,
+};
+
+// icon_usb.pbm: 16x16, 32 -> 22 bytes
+static const uint8_t asset_icon_usb_data[] = {
+    0x81, 0x00, 0x09, 0x30, 0x70, 0x84, 0x06, 0xFF, 0x06, 0x04, 0xA0, 0x70, 0x20, 0x87, 0x00, 0x03,
+    0x71, 0x7F, 0x72, 0x01, 0x84, 0x00,
+};
+
+const asset_t asset_icon_usb = {
+    .width = 16,
+    .pages = 2,
+    .flags = ASSET_RLE,
+    .size = 22,
+    .data = asset_icon_usb_data,
+};
+
+// splash.pbm: 128x64, 1024 -> 495 bytes
+static const uint8_t asset_splash_data[] = {
+    0x00, 0xFF, 0xFC, 0x01, 0x80, 0xFF, 0x81, 0x00, 0x02, 0xE0, 0xF8, 0xFC, 0x80, 0xFE, 0x02, 0xFF,
+    0x1F, 0x0F, 0x83, 0x07, 0x80, 0x0F, 0x03, 0x1F, 0x1E, 0x3E, 0x3C, 0x80, 0x38, 0x81, 0x00, 0x01,
+    0x7C, 0xFE, 0x80, 0xFF, 0x02, 0xFE, 0xFC, 0x80, 0x85, 0x00, 0x02, 0x80, 0xFC, 0xFE, 0x80, 0xFF,
+    0x01, 0xFE, 0x7C, 0x99, 0x00, 0x8B, 0x07, 0x02, 0x0F, 0x9F, 0xFF, 0x80, 0xFE, 0x02, 0xFC, 0xF8,
+    0x60, 0x81, 0x00, 0x8B, 0x07, 0x02, 0x0F, 0x9F, 0xFF, 0x80, 0xFE, 0x02, 0xFC, 0xF8, 0x60, 0x84,
+    0x00, 0x80, 0xFF, 0x81, 0x00, 0x84, 0xFF, 0x84, 0x00, 0x81, 0x70, 0x82, 0xF0, 0x01, 0xE0, 0xC0,
+    0x82, 0x00, 0x01, 0x01, 0x03, 0x80, 0x07, 0x80, 0x0F, 0x01, 0x8F, 0x8E, 0x82, 0xFE, 0x06, 0x7F,
+    0x3F, 0x1F, 0x0F, 0x07, 0x03, 0x01, 0x85, 0x00, 0x90, 0x0E, 0x87, 0x00, 0x85, 0x0E, 0x01, 0x1F,
+    0x3F, 0x81, 0xFF, 0x80, 0xF1, 0x00, 0xC0, 0x87, 0x00, 0x85, 0x0E, 0x01, 0x1F, 0x3F, 0x81, 0xFF,
+    0x80, 0xF1, 0x00, 0xC0, 0x84, 0x00, 0x80, 0xFF, 0x82, 0x00, 0x01, 0x03, 0x07, 0x80, 0x0F, 0x80,
+    0x1F, 0x00, 0x1E, 0x85, 0x1C, 0x00, 0x1F, 0x80, 0x0F, 0x01, 0x07, 0x03, 0x82, 0x00, 0x82, 0x1C,
+    0x80, 0x1E, 0x00, 0x1F, 0x80, 0x0F, 0x02, 0x07, 0x03, 0x01, 0xA2, 0x00, 0x8B, 0x1C, 0x00, 0x1E,
+    0x80, 0x1F, 0x80, 0x0F, 0x01, 0x07, 0x03, 0x82, 0x00, 0x8B, 0x1C, 0x00, 0x1E, 0x80, 0x1F, 0x80,
+    0x0F, 0x01, 0x07, 0x03, 0x85, 0x00, 0x80, 0xFF, 0x91, 0x00, 0x01, 0x80, 0xC0, 0x81, 0x40, 0x01,
+    0xC0, 0x80, 0x89, 0x00, 0x00, 0x40, 0x80, 0xC0, 0x94, 0x00, 0x80, 0x40, 0x94, 0x00, 0x80, 0xC0,
+    0xA4, 0x00, 0x80, 0xFF, 0x91, 0x00, 0x01, 0x0F, 0x1F, 0x81, 0x10, 0x04, 0x18, 0x08, 0x00, 0x0E,
+    0x1F, 0x81, 0x11, 0x01, 0x1F, 0x0E, 0x81, 0x00, 0x00, 0x10, 0x80, 0x1F, 0x00, 0x10, 0x80, 0x00,
+    0x01, 0x0E, 0x1F, 0x81, 0x11, 0x02, 0x1F, 0x0E, 0x00, 0x80, 0x1F, 0x81, 0x01, 0x01, 0x03, 0x02,
+    0x81, 0x00, 0x00, 0x11, 0x80, 0x1F, 0x00, 0x10, 0x80, 0x00, 0x80, 0x1F, 0x07, 0x06, 0x1E, 0x07,
+    0x1F, 0x1E, 0x00, 0x0E, 0x1F, 0x81, 0x15, 0x01, 0x17, 0x06, 0x80, 0x00, 0x80, 0x01, 0x01, 0x0F,
+    0x1F, 0x80, 0x11, 0x00, 0x00, 0x80, 0x1F, 0x81, 0x01, 0x04, 0x03, 0x02, 0x00, 0x0E, 0x1F, 0x81,
+    0x11, 0x01, 0x1F, 0x0E, 0x92, 0x00, 0x80, 0xFF, 0x91, 0x00, 0x80, 0xFC, 0x81, 0x24, 0x80, 0x04,
+    0x00, 0x00, 0x80, 0xF0, 0x05, 0x60, 0xE0, 0x70, 0xF0, 0xE0, 0x00, 0x80, 0xFC, 0x81, 0x20, 0x04,
+    0xE0, 0xC0, 0x00, 0x80, 0xD0, 0x81, 0x50, 0x02, 0xF0, 0xE0, 0x00, 0x80, 0xF0, 0x81, 0x10, 0x04,
+    0x30, 0x20, 0x00, 0xE0, 0xF0, 0x81, 0x10, 0x04, 0xB0, 0xA0, 0x00, 0x80, 0xD0, 0x81, 0x50, 0x02,
+    0xF0, 0xE0, 0x00, 0x81, 0x04, 0x80, 0xFC, 0x81, 0x04, 0x01, 0xE0, 0xF0, 0x81, 0x50, 0x04, 0x70,
+    0x60, 0x00, 0xE0, 0xF0, 0x81, 0x10, 0x02, 0xB0, 0xA0, 0x00, 0x80, 0xFC, 0x81, 0x10, 0x01, 0xF0,
+    0xE0, 0x92, 0x00, 0x80, 0xFF, 0x91, 0x80, 0x85, 0x81, 0x00, 0x80, 0x80, 0x81, 0x02, 0x80, 0x81,
+    0x80, 0x80, 0x81, 0x00, 0x80, 0x84, 0x81, 0x81, 0x80, 0x84, 0x81, 0x00, 0x80, 0x80, 0x81, 0x85,
+    0x80, 0x83, 0x81, 0x81, 0x80, 0x84, 0x81, 0x82, 0x80, 0x80, 0x81, 0x82, 0x80, 0x83, 0x81, 0x81,
+    0x80, 0x83, 0x81, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x81, 0x92, 0x80, 0x00, 0xFF,
+};
+
+const asset_t asset_splash = {
+    .width = 128,
+    .pages = 8,
+    .flags = ASSET_RLE,
+    .size = 495,
+    .data = asset_splash_data,
+};
+
+// status_missing.pbm: 8x8, 8 -> 8 bytes
+static const uint8_t asset_status_missing_data[] = {
+    0xFF, 0xC3, 0xA5, 0x99, 0x99, 0xA5, 0xC3, 0xFF,
+};
+
+const asset_t asset_status_missing = {
+    .width = 8,
+    .pages = 1,
+    .flags = 0,
+    .size = 8,
+    .data = asset_status_missing_data,
+};
+
+// status_ok.pbm: 8x8, 8 -> 8 bytes
+static const uint8_t asset_status_ok_data[] = {
+    0x18, 0x30, 0x60, 0x60, 0x30, 0x18, 0x0C, 0x06,
+};
+
+const asset_t asset_status_ok = {
+    .width = 8,
+    .pages = 1,
+    .flags = 0,
+    .size = 8,
+    .data = asset_status_ok_data,
+};
+
+// unit_lux.pbm: 12x8, 12 -> 12 bytes
+static const uint8_t asset_unit_lux_data[] = {
+    0x7F, 0x40, 0x00, 0x00, 0x44, 0x28, 0x10, 0x28, 0x44, 0x00, 0x00, 0x00,
+};
+
+const asset_t asset_unit_lux = {
+    .width = 12,
+    .pages = 1,
+    .flags = 0,
+    .size = 12,
+    .data = asset_unit_lux_data,
+};
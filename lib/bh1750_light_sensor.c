@@ -18,6 +18,49 @@ const uint8_t _CONT_HRES_C = 0x10;  // Modo de alta resolução (1 lux)
 const uint8_t _CONT_HRES2_C = 0x11; // Modo de alta resolução 2 (0.5 lux)
 const uint8_t _CONT_LRES_C = 0x13;  // Modo de baixa resolução (4 lux)
 
+#define _WARMUP_US 180000           // First H-resolution result after power on (max 180 ms)
+
+// The BH1750 has no readable registers: the shadow holds the last
+// power/mode opcode sent, so repeating the current mode costs no transaction
+static uint8_t _mode;
+static reg_shadow_t _shadow;
+
+// Every transaction goes through the presence tracker: an unplugged
+// sensor fails fast and is re-probed with backoff (lib/device_presence)
+static dev_presence_t _presence;
+
+// After a reconnect the result register reads zero until the first
+// measurement completes: results before this instant are "no data"
+static uint64_t _ready_us;
+
+static bool _shadow_write(reg_shadow_t* sh, uint8_t first, uint8_t count) {
+    (void)first;
+    (void)count;
+    return dev_presence_write(&_presence, &sh->values[0], 1, false);
+}
+
+/**
+ * @brief Reconnected: the sensor powered up in power-down state, so power
+ * it on and resend the current mode.
+ */
+static bool _on_online(dev_presence_t* dev) {
+    if (!dev_presence_write(dev, &_POWER_ON_C, 1, false))
+        return false;
+    _ready_us = time_us_64() + _WARMUP_US;
+    reg_shadow_invalidate(&_shadow);
+    return reg_shadow_flush(&_shadow) >= 0;
+}
+
+/**
+ * @brief Binds the driver to the bus and probes the sensor (first call only).
+ */
+static void _attach(i2c_inst_t* i2c) {
+    if (_shadow.write != NULL)
+        return;
+    reg_shadow_init(&_shadow, "bh1750", &_mode, 1, _shadow_write, NULL);
+    dev_presence_init(&_presence, "BH1750", i2c, _BH1750_I2C_ADDR, _on_online);
+}
+
 /**
  * @brief Push one byte of data to TX FIFO.
  * 
@@ -25,36 +68,104 @@ const uint8_t _CONT_LRES_C = 0x13;  // Modo de baixa resolução (4 lux)
  * @param byte Byte of data to push.
  */
 void _i2c_write_byte(i2c_inst_t* i2c, uint8_t byte) {
-    i2c_write_blocking(i2c, _BH1750_I2C_ADDR, &byte, 1, false);
+    _attach(i2c);
+    dev_presence_write(&_presence, &byte, 1, false);
+}
+
+/**
+ * @brief Sends a power/mode opcode unless it is already the current one.
+ * 
+ * @return true if the opcode went out on the bus (the mode changed).
+ */
+static bool _set_mode(i2c_inst_t* i2c, uint8_t opcode) {
+    _attach(i2c);
+    reg_shadow_set(&_shadow, 0, opcode);
+    return reg_shadow_flush(&_shadow) > 0;
+}
+
+/**
+ * @brief Reads the 2-byte result register and converts it to lux.
+ */
+static bool _read_result(uint16_t* lux) {
+    uint8_t buff[2];
+
+    // The read itself may be what detected the reconnect, so the warm-up
+    // is checked after it
+    if (!dev_presence_read(&_presence, buff, 2, false) || time_us_64() < _ready_us)
+        return false;
+
+    *lux = (((uint16_t)buff[0] << 8) | buff[1]) / 1.2;
+    // Obs. quando utilizar _CONT_HRES2_C dividir por 2.4
+    // Quando utilizar _CONT_HRES_C dividir por 1.2
+    return true;
 }
 
 /**
- * @brief Powers on the BH1750.
+ * @brief Powers on the BH1750 (the first call also probes for it).
  * 
  * @param i2c Initialized RP2040 I2C block.
  */
 void bh1750_power_on(i2c_inst_t* i2c) {
-    _i2c_write_byte(i2c, _POWER_ON_C);
+    _set_mode(i2c, _POWER_ON_C);
 }
 
 /**
  * @brief Get a measurement of ambient light from the BH1750.
  * 
  * @param i2c Initialized RP2040 I2C block.
- * @return uint16_t Measurement result (lux).
+ * @param lux Measurement result (lux).
+ * @return false if the sensor is missing (no data).
  */
-uint16_t bh1750_read_measurement(i2c_inst_t* i2c) {
-    // Send "Continuously H-resolution mode" instruction
-    _i2c_write_byte(i2c, _CONT_HRES_C);
+bool bh1750_read_measurement(i2c_inst_t* i2c, uint16_t* lux) {
+    // Send "Continuously H-resolution mode" instruction. If the sensor is
+    // already in that mode its result register is fresh (refreshed every
+    // ~120 ms), so neither the opcode nor the wait is needed.
+    if (_set_mode(i2c, _CONT_HRES_C)) {
+        // Wait at least 180 ms to complete measurement
+        sleep_ms(200);
+    }
 
-    // Wait at least 180 ms to complete measurement
-    sleep_ms(200);
+    return _read_result(lux);
+}
 
-    uint8_t buff[2];
+/**
+ * @brief Starts continuous H-resolution measurements.
+ * 
+ * The sensor then refreshes its result every ~120 ms on its own,
+ * so reads no longer need to resend the mode or wait.
+ * 
+ * @param i2c Initialized RP2040 I2C block.
+ */
+void bh1750_start_continuous(i2c_inst_t* i2c) {
+    _set_mode(i2c, _CONT_HRES_C);
+}
+
+/**
+ * @brief Reads the latest result of continuous mode without waiting.
+ * 
+ * @param i2c Initialized RP2040 I2C block.
+ * @param lux Measurement result (lux).
+ * @return false if the sensor is missing (no data).
+ */
+bool bh1750_read_latest(i2c_inst_t* i2c, uint16_t* lux) {
+    _attach(i2c);
+    return _read_result(lux);
+}
 
-    i2c_read_blocking(i2c, _BH1750_I2C_ADDR, buff, 2, false);
+/**
+ * @brief Shadow of the power/mode opcode (transactions sent and saved).
+ */
+const reg_shadow_t* bh1750_get_shadow(void) {
+    return &_shadow;
+}
 
-    return (((uint16_t)buff[0] << 8) | buff[1]) / 1.2;
-    // Obs. quando utilizar _CONT_HRES2_C dividir por 2.4
-    // Quando utilizar _CONT_HRES_C dividir por 1.2
-}
\ No newline at end of file
+/**
+ * @brief true while the sensor answers on the bus.
+ */
+bool bh1750_is_present(void) {
+    return dev_presence_online(&_presence);
+}
+
+const dev_presence_t* bh1750_get_presence(void) {
+    return &_presence;
+}
@@ -4,11 +4,23 @@
 #include "pico/stdlib.h"
 #include "hardware/i2c.h"
 #include "hardware/gpio.h"
+#include "reg_shadow.h"
+#include "device_presence.h"
 
 void _i2c_write_byte(i2c_inst_t* i2c, uint8_t byte); 
 
 void bh1750_power_on(i2c_inst_t* i2c);
 
-uint16_t bh1750_read_measurement(i2c_inst_t* i2c);
+bool bh1750_read_measurement(i2c_inst_t* i2c, uint16_t* lux);
+
+void bh1750_start_continuous(i2c_inst_t* i2c);
+
+bool bh1750_read_latest(i2c_inst_t* i2c, uint16_t* lux);
+
+const reg_shadow_t* bh1750_get_shadow(void);
+
+bool bh1750_is_present(void);
+
+const dev_presence_t* bh1750_get_presence(void);
 
 #endif
\ No newline at end of file
@@ -0,0 +1,86 @@
+#include "boot_profile.h"
+#include <stdio.h>
+#include "tusb.h"
+
+typedef struct
+{
+    const char *name;
+    uint64_t start_us;
+    uint64_t end_us;
+} boot_phase_t;
+
+// Uma tabela por núcleo: cada núcleo só escreve na sua
+static boot_phase_t phases[2][BOOT_MAX_PHASES];
+static uint8_t phase_count[2];
+static uint64_t boot_start_us;
+
+void boot_profile_start(void)
+{
+    boot_start_us = time_us_64();
+}
+
+void boot_phase_begin(const char *name)
+{
+    uint core = get_core_num();
+    if (phase_count[core] >= BOOT_MAX_PHASES)
+        return;
+
+    boot_phase_t *phase = &phases[core][phase_count[core]];
+    phase->name = name;
+    phase->start_us = time_us_64();
+    phase->end_us = 0;
+}
+
+void boot_phase_end(void)
+{
+    uint core = get_core_num();
+    if (phase_count[core] >= BOOT_MAX_PHASES)
+        return;
+
+    phases[core][phase_count[core]].end_us = time_us_64();
+    phase_count[core]++;
+}
+
+bool boot_wait_usb_host(void)
+{
+    // Um host presente reseta o barramento logo após o pull-up do D+;
+    // sem reset dentro da janela, considera-se que não há host.
+    absolute_time_t detect_deadline = delayed_by_ms(from_us_since_boot(boot_start_us), BOOT_USB_DETECT_MS);
+    while (!tud_connected())
+    {
+        if (time_reached(detect_deadline))
+            return false;
+        sleep_ms(1);
+    }
+
+    absolute_time_t enum_deadline = make_timeout_time_ms(BOOT_USB_ENUM_TIMEOUT_MS);
+    while (!tud_mounted())
+    {
+        if (time_reached(enum_deadline))
+            return false;
+        sleep_ms(1);
+    }
+
+    // Dá a um terminal já aberto a chance de sinalizar DTR antes do relatório
+    absolute_time_t terminal_deadline = make_timeout_time_ms(BOOT_USB_TERMINAL_MS);
+    while (!stdio_usb_connected() && !time_reached(terminal_deadline))
+    {
+        sleep_ms(1);
+    }
+    return true;
+}
+
+void boot_profile_report(void)
+{
+    printf("--- Boot (t0 = %llu us apos reset) ---\n", boot_start_us);
+    for (uint core = 0; core < 2; core++)
+    {
+        for (uint8_t i = 0; i < phase_count[core]; i++)
+        {
+            const boot_phase_t *phase = &phases[core][i];
+            printf("core%u %-14s inicio %6llu us  duracao %6llu us\n", core, phase->name,
+                   phase->start_us - boot_start_us, phase->end_us - phase->start_us);
+        }
+    }
+    printf("Boot total: %llu us\n", time_us_64() - boot_start_us);
+}
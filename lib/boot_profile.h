@@ -0,0 +1,53 @@
+#ifndef BOOT_PROFILE_H
+#define BOOT_PROFILE_H
+
+#include "pico/stdlib.h"
+
+// Número máximo de fases registradas por núcleo
+#define BOOT_MAX_PHASES 12
+
+// Janela para detectar um host USB (reset de barramento) após stdio_init_all
+#define BOOT_USB_DETECT_MS 200
+// Tempo máximo aguardando a enumeração quando há um host presente
+#define BOOT_USB_ENUM_TIMEOUT_MS 1500
+// Tempo extra para um terminal abrir a porta CDC após a enumeração
+#define BOOT_USB_TERMINAL_MS 250
+
+/**
+ * @brief Marca o instante de referência do boot (chamar logo no início de main).
+ */
+void boot_profile_start(void);
+
+/**
+ * @brief Inicia uma fase de boot no núcleo atual.
+ *
+ * Cada núcleo registra suas próprias fases, então os dois podem medir
+ * em paralelo sem sincronização.
+ *
+ * @param name Nome da fase (string estática).
+ */
+void boot_phase_begin(const char *name);
+
+/**
+ * @brief Encerra a fase aberta no núcleo atual.
+ */
+void boot_phase_end(void);
+
+/**
+ * @brief Aguarda a enumeração USB apenas se um host estiver presente.
+ *
+ * Sem host (alimentação por fonte), retorna após BOOT_USB_DETECT_MS contados
+ * a partir de boot_profile_start(), em vez de um atraso fixo.
+ *
+ * @return true se o dispositivo foi enumerado por um host.
+ */
+bool boot_wait_usb_host(void);
+
+/**
+ * @brief Imprime o relatório de tempos por fase e por núcleo.
+ *
+ * Deve ser chamado depois que o núcleo 1 terminou suas fases.
+ */
+void boot_profile_report(void);
+
+#endif // BOOT_PROFILE_H
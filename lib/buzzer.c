@@ -2,6 +2,12 @@
 #include "hardware/pwm.h"
 #include "hardware/clocks.h"
 
+// Clock do contador PWM nos toques (1 MHz), independente de clk_sys
+#define BUZZER_COUNTER_HZ 1000000
+
+// Última frequência de toque programada (0 = configuração inicial)
+static uint buzzer_freq = 0;
+
 // Função auxiliar interna para alterar a frequência do buzzer e retornar o valor de wrap.
 static uint16_t buzzer_set_freq(uint pino, uint freq)
 {
@@ -11,14 +17,16 @@ static uint16_t buzzer_set_freq(uint pino, uint freq)
         freq = 1;
 
     // Calcula o valor de 'wrap' para a frequência desejada.
-    // Clock (125MHz) / (divisor * freq) = wrap
-    float div = 125.0f;
-    uint32_t wrap = (uint32_t)(125000000 / (div * freq));
+    // O divisor é derivado de clk_sys para que o contador rode sempre a 1 MHz.
+    // clk_sys / div = 1MHz  ->  wrap = 1MHz / freq
+    float div = (float)clock_get_hz(clk_sys) / BUZZER_COUNTER_HZ;
+    uint32_t wrap = BUZZER_COUNTER_HZ / freq;
     if (wrap > 65535)
         wrap = 65535; // Garante que o valor de wrap não exceda o máximo de 16 bits
 
     pwm_set_clkdiv(slice_num, div);
     pwm_set_wrap(slice_num, wrap);
+    buzzer_freq = freq;
     return (uint16_t)wrap;
 }
 
@@ -32,6 +40,21 @@ void inicializar_buzzer(uint pino)
     pwm_config_set_clkdiv(&config, div);
     pwm_init(slice_num, &config, true);
     pwm_set_gpio_level(pino, 0); // Começa desligado
+    buzzer_freq = 0;
+}
+
+void buzzer_update_clock(uint pino)
+{
+    if (buzzer_freq != 0)
+    {
+        // Reaplica a última frequência de toque com o novo clk_sys
+        buzzer_set_freq(pino, buzzer_freq);
+    }
+    else
+    {
+        float div = (float)clock_get_hz(clk_sys) / (BUZZER_FREQUENCY * 4096);
+        pwm_set_clkdiv(pwm_gpio_to_slice_num(pino), div);
+    }
 }
 
 // Esta função usará uma aproximação para o duty cycle.
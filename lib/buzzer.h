@@ -6,6 +6,7 @@
 #define BUZZER_FREQUENCY 100 // Pode ser ajustado se quiser configurar externamente
 
 void inicializar_buzzer(uint pino);
+void buzzer_update_clock(uint pino);
 void ativar_buzzer_com_intensidade(uint pino, float intensidade);
 void ativar_buzzer(uint pino);
 void desativar_buzzer(uint pino);
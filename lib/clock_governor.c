@@ -0,0 +1,77 @@
+#include "clock_governor.h"
+#include "hardware/clocks.h"
+#include "hardware/sync.h"
+
+static clock_change_callback_t callbacks[CLOCK_GOV_MAX_CALLBACKS];
+static uint8_t callback_count = 0;
+
+static uint32_t idle_khz;
+static uint32_t boost_khz;
+static uint32_t hold_ms;
+static uint32_t current_khz;
+static absolute_time_t boost_deadline;
+
+// Verifica se o PLL consegue gerar a frequência pedida
+static bool clock_is_valid(uint32_t khz)
+{
+    uint vco, postdiv1, postdiv2;
+    return check_sys_clock_khz(khz, &vco, &postdiv1, &postdiv2);
+}
+
+// Troca o clock e re-deriva tudo o que depende dele, sem deixar
+// nenhuma interrupção rodar com divisores inconsistentes.
+static void clock_apply(uint32_t khz)
+{
+    if (khz == current_khz)
+        return;
+
+    uint32_t irq_state = save_and_disable_interrupts();
+    if (set_sys_clock_khz(khz, false))
+    {
+        current_khz = khz;
+        uint32_t sys_hz = clock_get_hz(clk_sys);
+        for (uint8_t i = 0; i < callback_count; i++)
+        {
+            callbacks[i](sys_hz);
+        }
+    }
+    restore_interrupts(irq_state);
+}
+
+void clock_governor_init(uint32_t idle, uint32_t boost, uint32_t hold)
+{
+    current_khz = clock_get_hz(clk_sys) / 1000;
+    idle_khz = clock_is_valid(idle) ? idle : current_khz;
+    boost_khz = clock_is_valid(boost) ? boost : current_khz;
+    hold_ms = hold;
+    boost_deadline = get_absolute_time();
+
+    clock_apply(idle_khz);
+}
+
+bool clock_governor_register(clock_change_callback_t cb)
+{
+    if (callback_count >= CLOCK_GOV_MAX_CALLBACKS)
+        return false;
+    callbacks[callback_count++] = cb;
+    return true;
+}
+
+void clock_governor_boost(void)
+{
+    boost_deadline = make_timeout_time_ms(hold_ms);
+    clock_apply(boost_khz);
+}
+
+void clock_governor_update(void)
+{
+    if (current_khz != idle_khz && time_reached(boost_deadline))
+    {
+        clock_apply(idle_khz);
+    }
+}
+
+uint32_t clock_governor_get_khz(void)
+{
+    return current_khz;
+}
@@ -0,0 +1,58 @@
+#ifndef CLOCK_GOVERNOR_H
+#define CLOCK_GOVERNOR_H
+
+#include "pico/stdlib.h"
+
+// Frequências padrão do governador (kHz)
+#define CLOCK_GOV_IDLE_KHZ 48000   // Ocioso: telas estáticas, espera de botões
+#define CLOCK_GOV_BOOST_KHZ 133000 // Rajada: redesenho completo, animações, amostragem rápida
+#define CLOCK_GOV_HOLD_MS 250      // Tempo mínimo em rajada após o último pedido
+
+// Número máximo de callbacks de mudança de clock
+#define CLOCK_GOV_MAX_CALLBACKS 8
+
+/**
+ * @brief Callback chamado sempre que o clock do sistema muda.
+ *
+ * É executado com as interrupções desabilitadas, logo após set_sys_clock_khz,
+ * e deve apenas reprogramar divisores/baud rates (sem I/O bloqueante).
+ *
+ * @param sys_hz Nova frequência de clk_sys em Hz.
+ */
+typedef void (*clock_change_callback_t)(uint32_t sys_hz);
+
+/**
+ * @brief Inicializa o governador e aplica o clock ocioso.
+ *
+ * Frequências que o PLL não consegue gerar exatamente são substituídas
+ * pelo clock atual.
+ *
+ * @param idle_khz Clock usado quando não há carga.
+ * @param boost_khz Clock usado durante rajadas de trabalho.
+ * @param hold_ms Tempo que o clock de rajada é mantido após o último pedido.
+ */
+void clock_governor_init(uint32_t idle_khz, uint32_t boost_khz, uint32_t hold_ms);
+
+/**
+ * @brief Registra um callback para re-derivar configurações dependentes do clock.
+ *
+ * @return false se a tabela de callbacks estiver cheia.
+ */
+bool clock_governor_register(clock_change_callback_t cb);
+
+/**
+ * @brief Pede o clock de rajada. Sobe imediatamente se necessário e renova o prazo.
+ */
+void clock_governor_boost(void);
+
+/**
+ * @brief Deve ser chamado no loop principal: volta ao clock ocioso quando o prazo expira.
+ */
+void clock_governor_update(void);
+
+/**
+ * @brief Retorna o clock do sistema atualmente aplicado pelo governador (kHz).
+ */
+uint32_t clock_governor_get_khz(void);
+
+#endif // CLOCK_GOVERNOR_H
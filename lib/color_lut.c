@@ -0,0 +1,72 @@
+#include "color_lut.h"
+
+#define LUT_FRAC_MASK ((1 << COLOR_LUT_SHIFT) - 1)
+#define LUT_STEP (1 << COLOR_LUT_SHIFT)
+
+void color_lut_apply(uint8_t r, uint8_t g, uint8_t b, uint8_t *r_out, uint8_t *g_out, uint8_t *b_out)
+{
+    uint8_t ir = r >> COLOR_LUT_SHIFT, fr = r & LUT_FRAC_MASK;
+    uint8_t ig = g >> COLOR_LUT_SHIFT, fg = g & LUT_FRAC_MASK;
+    uint8_t ib = b >> COLOR_LUT_SHIFT, fb = b & LUT_FRAC_MASK;
+
+    // Vértices do cubo: c000 (origem) e c111 (oposto) são comuns a todos os tetraedros
+    const uint8_t *c000 = color_lut_data[ir][ig][ib];
+    const uint8_t *c111 = color_lut_data[ir + 1][ig + 1][ib + 1];
+    const uint8_t *c1, *c2; // Vértices intermediários ao longo do caminho
+    uint8_t f1, f2, f3;     // Frações em ordem decrescente
+
+    if (fr >= fg)
+    {
+        if (fg >= fb)
+        { // r >= g >= b
+            c1 = color_lut_data[ir + 1][ig][ib];
+            c2 = color_lut_data[ir + 1][ig + 1][ib];
+            f1 = fr, f2 = fg, f3 = fb;
+        }
+        else if (fr >= fb)
+        { // r >= b > g
+            c1 = color_lut_data[ir + 1][ig][ib];
+            c2 = color_lut_data[ir + 1][ig][ib + 1];
+            f1 = fr, f2 = fb, f3 = fg;
+        }
+        else
+        { // b > r >= g
+            c1 = color_lut_data[ir][ig][ib + 1];
+            c2 = color_lut_data[ir + 1][ig][ib + 1];
+            f1 = fb, f2 = fr, f3 = fg;
+        }
+    }
+    else
+    {
+        if (fb > fg)
+        { // b > g > r
+            c1 = color_lut_data[ir][ig][ib + 1];
+            c2 = color_lut_data[ir][ig + 1][ib + 1];
+            f1 = fb, f2 = fg, f3 = fr;
+        }
+        else if (fb > fr)
+        { // g >= b > r
+            c1 = color_lut_data[ir][ig + 1][ib];
+            c2 = color_lut_data[ir][ig + 1][ib + 1];
+            f1 = fg, f2 = fb, f3 = fr;
+        }
+        else
+        { // g > r >= b
+            c1 = color_lut_data[ir][ig + 1][ib];
+            c2 = color_lut_data[ir + 1][ig + 1][ib];
+            f1 = fg, f2 = fr, f3 = fb;
+        }
+    }
+
+    // out = c000 + f1 (c1 - c000) + f2 (c2 - c1) + f3 (c111 - c2), frações em 1/16
+    uint8_t *out[3] = {r_out, g_out, b_out};
+    for (int ch = 0; ch < 3; ch++)
+    {
+        int32_t acc = c000[ch] * LUT_STEP +
+                      f1 * (c1[ch] - c000[ch]) +
+                      f2 * (c2[ch] - c1[ch]) +
+                      f3 * (c111[ch] - c2[ch]);
+        acc = (acc + LUT_STEP / 2) >> COLOR_LUT_SHIFT;
+        *out[ch] = acc < 0 ? 0 : acc > 255 ? 255 : acc;
+    }
+}
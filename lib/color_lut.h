@@ -0,0 +1,26 @@
+#ifndef COLOR_LUT_H
+#define COLOR_LUT_H
+
+#include "pico/stdlib.h"
+
+// Grade de 17 nós por eixo: nós em 0, 16, ..., 256 (o último corresponde a 255)
+#define COLOR_LUT_NODES 17
+#define COLOR_LUT_SHIFT 4
+
+/**
+ * @brief Tabela 3D RGB -> RGB em flash, gerada por tools/build_lut.py.
+ *
+ * Indexada [r][g][b][canal] pelos nós da grade.
+ */
+extern const uint8_t color_lut_data[COLOR_LUT_NODES][COLOR_LUT_NODES][COLOR_LUT_NODES][3];
+
+/**
+ * @brief Corrige uma cor já normalizada (preto/branco) pela tabela 3D.
+ *
+ * Interpolação tetraédrica inteira: o cubo da grade que contém a cor é
+ * dividido em seis tetraedros e só os quatro vértices do tetraedro
+ * escolhido entram na conta (4 leituras e 9 multiplicações inteiras).
+ */
+void color_lut_apply(uint8_t r, uint8_t g, uint8_t b, uint8_t *r_out, uint8_t *g_out, uint8_t *b_out);
+
+#endif // COLOR_LUT_H
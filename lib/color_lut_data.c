@@ -0,0 +1,331 @@
+// Gerado por tools/build_lut.py - não editar à mão.
+// Origem: CCM de lib/gy33.c
+// Nós em 0, 16, ..., 240, 255 por eixo; indexado [r][g][b][canal].
+
+#include "color_lut.h"
+
+const uint8_t color_lut_data[COLOR_LUT_NODES][COLOR_LUT_NODES][COLOR_LUT_NODES][3] = {
+    {
+        {{0, 0, 0}, {0, 0, 66}, {0, 0, 132}, {0, 0, 197}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}},
+        {{0, 101, 0}, {0, 62, 23}, {0, 24, 88}, {0, 0, 154}, {0, 0, 220}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}},
+        {{0, 202, 0}, {0, 164, 0}, {0, 125, 45}, {0, 86, 111}, {0, 47, 177}, {0, 9, 242}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}},
+        {{0, 255, 0}, {0, 255, 0}, {0, 226, 2}, {0, 187, 68}, {0, 148, 133}, {0, 110, 199}, {0, 71, 255}, {0, 32, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}},
+        {{0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 24}, {0, 250, 90}, {0, 211, 156}, {0, 172, 222}, {0, 133, 255}, {0, 95, 255}, {0, 56, 255}, {0, 17, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}},
+        {{0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 47}, {0, 255, 113}, {0, 255, 179}, {0, 235, 244}, {0, 196, 255}, {0, 157, 255}, {0, 118, 255}, {0, 80, 255}, {0, 41, 255}, {0, 2, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}},
+        {{0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 4}, {0, 255, 70}, {0, 255, 135}, {0, 255, 201}, {0, 255, 255}, {0, 255, 255}, {0, 220, 255}, {0, 181, 255}, {0, 142, 255}, {0, 103, 255}, {0, 65, 255}, {0, 26, 255}, {0, 0, 255}},
+        {{0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 26}, {0, 255, 92}, {0, 255, 158}, {0, 255, 224}, {0, 255, 255}, {0, 255, 255}, {0, 255, 255}, {0, 243, 255}, {0, 204, 255}, {0, 166, 255}, {0, 127, 255}, {0, 91, 255}},
+        {{0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 49}, {0, 255, 115}, {0, 255, 180}, {0, 255, 246}, {0, 255, 255}, {0, 255, 255}, {0, 255, 255}, {0, 255, 255}, {0, 255, 255}, {0, 228, 255}, {0, 192, 255}},
+        {{0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 6}, {0, 255, 72}, {0, 255, 137}, {0, 255, 203}, {0, 255, 255}, {0, 255, 255}, {0, 255, 255}, {0, 255, 255}, {0, 255, 255}, {0, 255, 255}, {0, 255, 255}},
+        {{0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 28}, {0, 255, 94}, {0, 255, 160}, {0, 255, 226}, {0, 255, 255}, {0, 255, 255}, {0, 255, 255}, {0, 255, 255}, {0, 255, 255}, {0, 255, 255}},
+        {{0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 51}, {0, 255, 117}, {0, 255, 182}, {0, 255, 248}, {0, 255, 255}, {0, 255, 255}, {0, 255, 255}, {0, 255, 255}, {0, 255, 255}},
+        {{0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 8}, {0, 255, 73}, {0, 255, 139}, {0, 255, 205}, {0, 255, 255}, {0, 255, 255}, {0, 255, 255}, {0, 255, 255}, {0, 255, 255}},
+        {{0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 30}, {0, 255, 96}, {0, 255, 162}, {0, 255, 228}, {0, 255, 255}, {0, 255, 255}, {0, 255, 255}, {0, 255, 255}},
+        {{0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 53}, {0, 255, 119}, {0, 255, 184}, {0, 255, 250}, {0, 255, 255}, {0, 255, 255}, {0, 255, 255}},
+        {{0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 10}, {0, 255, 75}, {0, 255, 141}, {0, 255, 207}, {0, 255, 255}, {0, 255, 255}, {0, 255, 255}},
+        {{0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 35}, {0, 255, 101}, {0, 255, 166}, {0, 255, 232}, {0, 255, 255}, {0, 255, 255}},
+    },
+    {
+        {{29, 0, 0}, {21, 0, 61}, {14, 0, 127}, {6, 0, 193}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}},
+        {{27, 94, 0}, {20, 55, 18}, {12, 16, 84}, {4, 0, 150}, {0, 0, 215}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}},
+        {{26, 195, 0}, {18, 156, 0}, {10, 117, 41}, {3, 79, 106}, {0, 40, 172}, {0, 1, 238}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}},
+        {{24, 255, 0}, {16, 255, 0}, {9, 219, 0}, {1, 180, 63}, {0, 141, 129}, {0, 102, 195}, {0, 64, 255}, {0, 25, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}},
+        {{23, 255, 0}, {15, 255, 0}, {7, 255, 0}, {0, 255, 20}, {0, 242, 86}, {0, 204, 152}, {0, 165, 217}, {0, 126, 255}, {0, 87, 255}, {0, 49, 255}, {0, 10, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}},
+        {{21, 255, 0}, {13, 255, 0}, {6, 255, 0}, {0, 255, 0}, {0, 255, 43}, {0, 255, 108}, {0, 255, 174}, {0, 227, 240}, {0, 188, 255}, {0, 150, 255}, {0, 111, 255}, {0, 72, 255}, {0, 34, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}},
+        {{19, 255, 0}, {12, 255, 0}, {4, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 65}, {0, 255, 131}, {0, 255, 197}, {0, 255, 255}, {0, 251, 255}, {0, 212, 255}, {0, 173, 255}, {0, 135, 255}, {0, 96, 255}, {0, 57, 255}, {0, 19, 255}, {0, 0, 255}},
+        {{18, 255, 0}, {10, 255, 0}, {2, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 22}, {0, 255, 88}, {0, 255, 153}, {0, 255, 219}, {0, 255, 255}, {0, 255, 255}, {0, 255, 255}, {0, 236, 255}, {0, 197, 255}, {0, 158, 255}, {0, 120, 255}, {0, 83, 255}},
+        {{16, 255, 0}, {8, 255, 0}, {1, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 44}, {0, 255, 110}, {0, 255, 176}, {0, 255, 242}, {0, 255, 255}, {0, 255, 255}, {0, 255, 255}, {0, 255, 255}, {0, 255, 255}, {0, 221, 255}, {0, 184, 255}},
+        {{15, 255, 0}, {7, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 1}, {0, 255, 67}, {0, 255, 133}, {0, 255, 199}, {0, 255, 255}, {0, 255, 255}, {0, 255, 255}, {0, 255, 255}, {0, 255, 255}, {0, 255, 255}, {0, 255, 255}},
+        {{13, 255, 0}, {5, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 24}, {0, 255, 90}, {0, 255, 155}, {0, 255, 221}, {0, 255, 255}, {0, 255, 255}, {0, 255, 255}, {0, 255, 255}, {0, 255, 255}, {0, 255, 255}},
+        {{11, 255, 0}, {4, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 46}, {0, 255, 112}, {0, 255, 178}, {0, 255, 244}, {0, 255, 255}, {0, 255, 255}, {0, 255, 255}, {0, 255, 255}, {0, 255, 255}},
+        {{10, 255, 0}, {2, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 3}, {0, 255, 69}, {0, 255, 135}, {0, 255, 200}, {0, 255, 255}, {0, 255, 255}, {0, 255, 255}, {0, 255, 255}, {0, 255, 255}},
+        {{8, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 26}, {0, 255, 92}, {0, 255, 157}, {0, 255, 223}, {0, 255, 255}, {0, 255, 255}, {0, 255, 255}, {0, 255, 255}},
+        {{7, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 48}, {0, 255, 114}, {0, 255, 180}, {0, 255, 246}, {0, 255, 255}, {0, 255, 255}, {0, 255, 255}},
+        {{5, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 5}, {0, 255, 71}, {0, 255, 137}, {0, 255, 202}, {0, 255, 255}, {0, 255, 255}, {0, 255, 255}},
+        {{3, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 30}, {0, 255, 96}, {0, 255, 162}, {0, 255, 228}, {0, 255, 255}, {0, 255, 255}},
+    },
+    {
+        {{58, 0, 0}, {50, 0, 57}, {43, 0, 123}, {35, 0, 188}, {27, 0, 254}, {20, 0, 255}, {12, 0, 255}, {4, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}},
+        {{56, 86, 0}, {49, 48, 14}, {41, 9, 79}, {33, 0, 145}, {26, 0, 211}, {18, 0, 255}, {10, 0, 255}, {3, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}},
+        {{55, 188, 0}, {47, 149, 0}, {39, 110, 36}, {32, 71, 102}, {24, 33, 168}, {16, 0, 233}, {9, 0, 255}, {1, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}},
+        {{53, 255, 0}, {45, 250, 0}, {38, 211, 0}, {30, 172, 59}, {22, 134, 124}, {15, 95, 190}, {7, 56, 255}, {0, 18, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}},
+        {{52, 255, 0}, {44, 255, 0}, {36, 255, 0}, {28, 255, 16}, {21, 235, 81}, {13, 196, 147}, {5, 157, 213}, {0, 119, 255}, {0, 80, 255}, {0, 41, 255}, {0, 3, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}},
+        {{50, 255, 0}, {42, 255, 0}, {35, 255, 0}, {27, 255, 0}, {19, 255, 38}, {12, 255, 104}, {4, 255, 170}, {0, 220, 235}, {0, 181, 255}, {0, 142, 255}, {0, 104, 255}, {0, 65, 255}, {0, 26, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}},
+        {{48, 255, 0}, {41, 255, 0}, {33, 255, 0}, {25, 255, 0}, {18, 255, 0}, {10, 255, 61}, {2, 255, 126}, {0, 255, 192}, {0, 255, 255}, {0, 244, 255}, {0, 205, 255}, {0, 166, 255}, {0, 127, 255}, {0, 89, 255}, {0, 50, 255}, {0, 11, 255}, {0, 0, 255}},
+        {{47, 255, 0}, {39, 255, 0}, {31, 255, 0}, {24, 255, 0}, {16, 255, 0}, {8, 255, 17}, {1, 255, 83}, {0, 255, 149}, {0, 255, 215}, {0, 255, 255}, {0, 255, 255}, {0, 255, 255}, {0, 228, 255}, {0, 190, 255}, {0, 151, 255}, {0, 112, 255}, {0, 76, 255}},
+        {{45, 255, 0}, {37, 255, 0}, {30, 255, 0}, {22, 255, 0}, {14, 255, 0}, {7, 255, 0}, {0, 255, 40}, {0, 255, 106}, {0, 255, 172}, {0, 255, 237}, {0, 255, 255}, {0, 255, 255}, {0, 255, 255}, {0, 255, 255}, {0, 252, 255}, {0, 213, 255}, {0, 177, 255}},
+        {{44, 255, 0}, {36, 255, 0}, {28, 255, 0}, {20, 255, 0}, {13, 255, 0}, {5, 255, 0}, {0, 255, 0}, {0, 255, 63}, {0, 255, 128}, {0, 255, 194}, {0, 255, 255}, {0, 255, 255}, {0, 255, 255}, {0, 255, 255}, {0, 255, 255}, {0, 255, 255}, {0, 255, 255}},
+        {{42, 255, 0}, {34, 255, 0}, {27, 255, 0}, {19, 255, 0}, {11, 255, 0}, {4, 255, 0}, {0, 255, 0}, {0, 255, 19}, {0, 255, 85}, {0, 255, 151}, {0, 255, 217}, {0, 255, 255}, {0, 255, 255}, {0, 255, 255}, {0, 255, 255}, {0, 255, 255}, {0, 255, 255}},
+        {{40, 255, 0}, {33, 255, 0}, {25, 255, 0}, {17, 255, 0}, {10, 255, 0}, {2, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 42}, {0, 255, 108}, {0, 255, 173}, {0, 255, 239}, {0, 255, 255}, {0, 255, 255}, {0, 255, 255}, {0, 255, 255}, {0, 255, 255}},
+        {{39, 255, 0}, {31, 255, 0}, {23, 255, 0}, {16, 255, 0}, {8, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 64}, {0, 255, 130}, {0, 255, 196}, {0, 255, 255}, {0, 255, 255}, {0, 255, 255}, {0, 255, 255}, {0, 255, 255}},
+        {{37, 255, 0}, {29, 255, 0}, {22, 255, 0}, {14, 255, 0}, {6, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 21}, {0, 255, 87}, {0, 255, 153}, {0, 255, 219}, {0, 255, 255}, {0, 255, 255}, {0, 255, 255}, {0, 255, 255}},
+        {{36, 255, 0}, {28, 255, 0}, {20, 255, 0}, {12, 255, 0}, {5, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 44}, {0, 255, 110}, {0, 255, 175}, {0, 255, 241}, {0, 255, 255}, {0, 255, 255}, {0, 255, 255}},
+        {{34, 255, 0}, {26, 255, 0}, {19, 255, 0}, {11, 255, 0}, {3, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 1}, {0, 255, 66}, {0, 255, 132}, {0, 255, 198}, {0, 255, 255}, {0, 255, 255}, {0, 255, 255}},
+        {{32, 255, 0}, {25, 255, 0}, {17, 255, 0}, {9, 255, 0}, {2, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 26}, {0, 255, 92}, {0, 255, 157}, {0, 255, 223}, {0, 255, 255}, {0, 255, 255}},
+    },
+    {
+        {{87, 0, 0}, {79, 0, 52}, {72, 0, 118}, {64, 0, 184}, {56, 0, 250}, {48, 0, 255}, {41, 0, 255}, {33, 0, 255}, {25, 0, 255}, {18, 0, 255}, {10, 0, 255}, {2, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}},
+        {{85, 79, 0}, {78, 40, 9}, {70, 2, 75}, {62, 0, 141}, {55, 0, 206}, {47, 0, 255}, {39, 0, 255}, {32, 0, 255}, {24, 0, 255}, {16, 0, 255}, {8, 0, 255}, {1, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}},
+        {{84, 180, 0}, {76, 141, 0}, {68, 103, 32}, {61, 64, 97}, {53, 25, 163}, {45, 0, 229}, {38, 0, 255}, {30, 0, 255}, {22, 0, 255}, {15, 0, 255}, {7, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}},
+        {{82, 255, 0}, {74, 243, 0}, {67, 204, 0}, {59, 165, 54}, {51, 126, 120}, {44, 88, 186}, {36, 49, 252}, {28, 10, 255}, {21, 0, 255}, {13, 0, 255}, {5, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}},
+        {{80, 255, 0}, {73, 255, 0}, {65, 255, 0}, {57, 255, 11}, {50, 228, 77}, {42, 189, 143}, {34, 150, 208}, {27, 111, 255}, {19, 73, 255}, {11, 34, 255}, {4, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}},
+        {{79, 255, 0}, {71, 255, 0}, {64, 255, 0}, {56, 255, 0}, {48, 255, 34}, {40, 255, 99}, {33, 251, 165}, {25, 212, 231}, {17, 174, 255}, {10, 135, 255}, {2, 96, 255}, {0, 58, 255}, {0, 19, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}},
+        {{77, 255, 0}, {70, 255, 0}, {62, 255, 0}, {54, 255, 0}, {47, 255, 0}, {39, 255, 56}, {31, 255, 122}, {24, 255, 188}, {16, 255, 253}, {8, 236, 255}, {0, 197, 255}, {0, 159, 255}, {0, 120, 255}, {0, 81, 255}, {0, 43, 255}, {0, 4, 255}, {0, 0, 255}},
+        {{76, 255, 0}, {68, 255, 0}, {60, 255, 0}, {53, 255, 0}, {45, 255, 0}, {37, 255, 13}, {30, 255, 79}, {22, 255, 144}, {14, 255, 210}, {7, 255, 255}, {0, 255, 255}, {0, 255, 255}, {0, 221, 255}, {0, 182, 255}, {0, 144, 255}, {0, 105, 255}, {0, 69, 255}},
+        {{74, 255, 0}, {66, 255, 0}, {59, 255, 0}, {51, 255, 0}, {43, 255, 0}, {36, 255, 0}, {28, 255, 36}, {20, 255, 101}, {13, 255, 167}, {5, 255, 233}, {0, 255, 255}, {0, 255, 255}, {0, 255, 255}, {0, 255, 255}, {0, 245, 255}, {0, 206, 255}, {0, 170, 255}},
+        {{72, 255, 0}, {65, 255, 0}, {57, 255, 0}, {49, 255, 0}, {42, 255, 0}, {34, 255, 0}, {26, 255, 0}, {19, 255, 58}, {11, 255, 124}, {3, 255, 190}, {0, 255, 255}, {0, 255, 255}, {0, 255, 255}, {0, 255, 255}, {0, 255, 255}, {0, 255, 255}, {0, 255, 255}},
+        {{71, 255, 0}, {63, 255, 0}, {56, 255, 0}, {48, 255, 0}, {40, 255, 0}, {32, 255, 0}, {25, 255, 0}, {17, 255, 15}, {9, 255, 81}, {2, 255, 146}, {0, 255, 212}, {0, 255, 255}, {0, 255, 255}, {0, 255, 255}, {0, 255, 255}, {0, 255, 255}, {0, 255, 255}},
+        {{69, 255, 0}, {62, 255, 0}, {54, 255, 0}, {46, 255, 0}, {39, 255, 0}, {31, 255, 0}, {23, 255, 0}, {16, 255, 0}, {8, 255, 37}, {0, 255, 103}, {0, 255, 169}, {0, 255, 235}, {0, 255, 255}, {0, 255, 255}, {0, 255, 255}, {0, 255, 255}, {0, 255, 255}},
+        {{68, 255, 0}, {60, 255, 0}, {52, 255, 0}, {45, 255, 0}, {37, 255, 0}, {29, 255, 0}, {22, 255, 0}, {14, 255, 0}, {6, 255, 0}, {0, 255, 60}, {0, 255, 126}, {0, 255, 192}, {0, 255, 255}, {0, 255, 255}, {0, 255, 255}, {0, 255, 255}, {0, 255, 255}},
+        {{66, 255, 0}, {58, 255, 0}, {51, 255, 0}, {43, 255, 0}, {35, 255, 0}, {28, 255, 0}, {20, 255, 0}, {12, 255, 0}, {5, 255, 0}, {0, 255, 17}, {0, 255, 83}, {0, 255, 148}, {0, 255, 214}, {0, 255, 255}, {0, 255, 255}, {0, 255, 255}, {0, 255, 255}},
+        {{64, 255, 0}, {57, 255, 0}, {49, 255, 0}, {41, 255, 0}, {34, 255, 0}, {26, 255, 0}, {18, 255, 0}, {11, 255, 0}, {3, 255, 0}, {0, 255, 0}, {0, 255, 39}, {0, 255, 105}, {0, 255, 171}, {0, 255, 237}, {0, 255, 255}, {0, 255, 255}, {0, 255, 255}},
+        {{63, 255, 0}, {55, 255, 0}, {48, 255, 0}, {40, 255, 0}, {32, 255, 0}, {24, 255, 0}, {17, 255, 0}, {9, 255, 0}, {1, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 62}, {0, 255, 128}, {0, 255, 193}, {0, 255, 255}, {0, 255, 255}, {0, 255, 255}},
+        {{61, 255, 0}, {54, 255, 0}, {46, 255, 0}, {38, 255, 0}, {31, 255, 0}, {23, 255, 0}, {15, 255, 0}, {8, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 21}, {0, 255, 87}, {0, 255, 153}, {0, 255, 219}, {0, 255, 255}, {0, 255, 255}},
+    },
+    {
+        {{116, 0, 0}, {108, 0, 48}, {100, 0, 114}, {93, 0, 179}, {85, 0, 245}, {77, 0, 255}, {70, 0, 255}, {62, 0, 255}, {54, 0, 255}, {47, 0, 255}, {39, 0, 255}, {31, 0, 255}, {24, 0, 255}, {16, 0, 255}, {8, 0, 255}, {1, 0, 255}, {0, 0, 255}},
+        {{114, 72, 0}, {107, 33, 5}, {99, 0, 70}, {91, 0, 136}, {84, 0, 202}, {76, 0, 255}, {68, 0, 255}, {60, 0, 255}, {53, 0, 255}, {45, 0, 255}, {37, 0, 255}, {30, 0, 255}, {22, 0, 255}, {14, 0, 255}, {7, 0, 255}, {0, 0, 255}, {0, 0, 255}},
+        {{113, 173, 0}, {105, 134, 0}, {97, 95, 27}, {90, 57, 93}, {82, 18, 159}, {74, 0, 224}, {67, 0, 255}, {59, 0, 255}, {51, 0, 255}, {44, 0, 255}, {36, 0, 255}, {28, 0, 255}, {20, 0, 255}, {13, 0, 255}, {5, 0, 255}, {0, 0, 255}, {0, 0, 255}},
+        {{111, 255, 0}, {103, 235, 0}, {96, 196, 0}, {88, 158, 50}, {80, 119, 116}, {73, 80, 181}, {65, 42, 247}, {57, 3, 255}, {50, 0, 255}, {42, 0, 255}, {34, 0, 255}, {27, 0, 255}, {19, 0, 255}, {11, 0, 255}, {4, 0, 255}, {0, 0, 255}, {0, 0, 255}},
+        {{109, 255, 0}, {102, 255, 0}, {94, 255, 0}, {86, 255, 7}, {79, 220, 72}, {71, 181, 138}, {63, 143, 204}, {56, 104, 255}, {48, 65, 255}, {40, 27, 255}, {33, 0, 255}, {25, 0, 255}, {17, 0, 255}, {10, 0, 255}, {2, 0, 255}, {0, 0, 255}, {0, 0, 255}},
+        {{108, 255, 0}, {100, 255, 0}, {92, 255, 0}, {85, 255, 0}, {77, 255, 29}, {69, 255, 95}, {62, 244, 161}, {54, 205, 226}, {46, 166, 255}, {39, 128, 255}, {31, 89, 255}, {23, 50, 255}, {16, 12, 255}, {8, 0, 255}, {0, 0, 255}, {0, 0, 255}, {0, 0, 255}},
+        {{106, 255, 0}, {99, 255, 0}, {91, 255, 0}, {83, 255, 0}, {76, 255, 0}, {68, 255, 52}, {60, 255, 117}, {52, 255, 183}, {45, 255, 249}, {37, 229, 255}, {29, 190, 255}, {22, 151, 255}, {14, 113, 255}, {6, 74, 255}, {0, 35, 255}, {0, 0, 255}, {0, 0, 255}},
+        {{105, 255, 0}, {97, 255, 0}, {89, 255, 0}, {82, 255, 0}, {74, 255, 0}, {66, 255, 8}, {59, 255, 74}, {51, 255, 140}, {43, 255, 206}, {36, 255, 255}, {28, 255, 255}, {20, 252, 255}, {12, 214, 255}, {5, 175, 255}, {0, 136, 255}, {0, 98, 255}, {0, 61, 255}},
+        {{103, 255, 0}, {95, 255, 0}, {88, 255, 0}, {80, 255, 0}, {72, 255, 0}, {65, 255, 0}, {57, 255, 31}, {49, 255, 97}, {42, 255, 163}, {34, 255, 228}, {26, 255, 255}, {19, 255, 255}, {11, 255, 255}, {3, 255, 255}, {0, 237, 255}, {0, 199, 255}, {0, 162, 255}},
+        {{101, 255, 0}, {94, 255, 0}, {86, 255, 0}, {78, 255, 0}, {71, 255, 0}, {63, 255, 0}, {55, 255, 0}, {48, 255, 54}, {40, 255, 119}, {32, 255, 185}, {25, 255, 251}, {17, 255, 255}, {9, 255, 255}, {2, 255, 255}, {0, 255, 255}, {0, 255, 255}, {0, 255, 255}},
+        {{100, 255, 0}, {92, 255, 0}, {84, 255, 0}, {77, 255, 0}, {69, 255, 0}, {61, 255, 0}, {54, 255, 0}, {46, 255, 10}, {38, 255, 76}, {31, 255, 142}, {23, 255, 208}, {15, 255, 255}, {8, 255, 255}, {0, 255, 255}, {0, 255, 255}, {0, 255, 255}, {0, 255, 255}},
+        {{98, 255, 0}, {91, 255, 0}, {83, 255, 0}, {75, 255, 0}, {68, 255, 0}, {60, 255, 0}, {52, 255, 0}, {44, 255, 0}, {37, 255, 33}, {29, 255, 99}, {21, 255, 164}, {14, 255, 230}, {6, 255, 255}, {0, 255, 255}, {0, 255, 255}, {0, 255, 255}, {0, 255, 255}},
+        {{97, 255, 0}, {89, 255, 0}, {81, 255, 0}, {74, 255, 0}, {66, 255, 0}, {58, 255, 0}, {51, 255, 0}, {43, 255, 0}, {35, 255, 0}, {28, 255, 56}, {20, 255, 121}, {12, 255, 187}, {4, 255, 253}, {0, 255, 255}, {0, 255, 255}, {0, 255, 255}, {0, 255, 255}},
+        {{95, 255, 0}, {87, 255, 0}, {80, 255, 0}, {72, 255, 0}, {64, 255, 0}, {57, 255, 0}, {49, 255, 0}, {41, 255, 0}, {34, 255, 0}, {26, 255, 12}, {18, 255, 78}, {11, 255, 144}, {3, 255, 210}, {0, 255, 255}, {0, 255, 255}, {0, 255, 255}, {0, 255, 255}},
+        {{93, 255, 0}, {86, 255, 0}, {78, 255, 0}, {70, 255, 0}, {63, 255, 0}, {55, 255, 0}, {47, 255, 0}, {40, 255, 0}, {32, 255, 0}, {24, 255, 0}, {17, 255, 35}, {9, 255, 101}, {1, 255, 166}, {0, 255, 232}, {0, 255, 255}, {0, 255, 255}, {0, 255, 255}},
+        {{92, 255, 0}, {84, 255, 0}, {76, 255, 0}, {69, 255, 0}, {61, 255, 0}, {53, 255, 0}, {46, 255, 0}, {38, 255, 0}, {30, 255, 0}, {23, 255, 0}, {15, 255, 0}, {7, 255, 57}, {0, 255, 123}, {0, 255, 189}, {0, 255, 255}, {0, 255, 255}, {0, 255, 255}},
+        {{90, 255, 0}, {83, 255, 0}, {75, 255, 0}, {67, 255, 0}, {60, 255, 0}, {52, 255, 0}, {44, 255, 0}, {37, 255, 0}, {29, 255, 0}, {21, 255, 0}, {14, 255, 0}, {6, 255, 17}, {0, 255, 83}, {0, 255, 148}, {0, 255, 214}, {0, 255, 255}, {0, 255, 255}},
+    },
+    {
+        {{145, 0, 0}, {137, 0, 43}, {129, 0, 109}, {122, 0, 175}, {114, 0, 241}, {106, 0, 255}, {99, 0, 255}, {91, 0, 255}, {83, 0, 255}, {76, 0, 255}, {68, 0, 255}, {60, 0, 255}, {53, 0, 255}, {45, 0, 255}, {37, 0, 255}, {30, 0, 255}, {22, 0, 255}},
+        {{143, 64, 0}, {136, 26, 0}, {128, 0, 66}, {120, 0, 132}, {112, 0, 197}, {105, 0, 255}, {97, 0, 255}, {89, 0, 255}, {82, 0, 255}, {74, 0, 255}, {66, 0, 255}, {59, 0, 255}, {51, 0, 255}, {43, 0, 255}, {36, 0, 255}, {28, 0, 255}, {21, 0, 255}},
+        {{142, 165, 0}, {134, 127, 0}, {126, 88, 23}, {119, 49, 88}, {111, 11, 154}, {103, 0, 220}, {96, 0, 255}, {88, 0, 255}, {80, 0, 255}, {72, 0, 255}, {65, 0, 255}, {57, 0, 255}, {49, 0, 255}, {42, 0, 255}, {34, 0, 255}, {26, 0, 255}, {19, 0, 255}},
+        {{140, 255, 0}, {132, 228, 0}, {125, 189, 0}, {117, 150, 45}, {109, 112, 111}, {102, 73, 177}, {94, 34, 243}, {86, 0, 255}, {79, 0, 255}, {71, 0, 255}, {63, 0, 255}, {56, 0, 255}, {48, 0, 255}, {40, 0, 255}, {32, 0, 255}, {25, 0, 255}, {18, 0, 255}},
+        {{138, 255, 0}, {131, 255, 0}, {123, 255, 0}, {115, 252, 2}, {108, 213, 68}, {100, 174, 134}, {92, 135, 199}, {85, 97, 255}, {77, 58, 255}, {69, 19, 255}, {62, 0, 255}, {54, 0, 255}, {46, 0, 255}, {39, 0, 255}, {31, 0, 255}, {23, 0, 255}, {16, 0, 255}},
+        {{137, 255, 0}, {129, 255, 0}, {121, 255, 0}, {114, 255, 0}, {106, 255, 25}, {98, 255, 90}, {91, 236, 156}, {83, 198, 222}, {75, 159, 255}, {68, 120, 255}, {60, 82, 255}, {52, 43, 255}, {45, 4, 255}, {37, 0, 255}, {29, 0, 255}, {22, 0, 255}, {14, 0, 255}},
+        {{135, 255, 0}, {128, 255, 0}, {120, 255, 0}, {112, 255, 0}, {104, 255, 0}, {97, 255, 47}, {89, 255, 113}, {81, 255, 179}, {74, 255, 244}, {66, 221, 255}, {58, 183, 255}, {51, 144, 255}, {43, 105, 255}, {35, 67, 255}, {28, 28, 255}, {20, 0, 255}, {13, 0, 255}},
+        {{134, 255, 0}, {126, 255, 0}, {118, 255, 0}, {111, 255, 0}, {103, 255, 0}, {95, 255, 4}, {88, 255, 70}, {80, 255, 136}, {72, 255, 201}, {64, 255, 255}, {57, 255, 255}, {49, 245, 255}, {41, 206, 255}, {34, 168, 255}, {26, 129, 255}, {18, 90, 255}, {11, 54, 255}},
+        {{132, 255, 0}, {124, 255, 0}, {117, 255, 0}, {109, 255, 0}, {101, 255, 0}, {94, 255, 0}, {86, 255, 27}, {78, 255, 92}, {71, 255, 158}, {63, 255, 224}, {55, 255, 255}, {48, 255, 255}, {40, 255, 255}, {32, 255, 255}, {24, 230, 255}, {17, 191, 255}, {10, 155, 255}},
+        {{130, 255, 0}, {123, 255, 0}, {115, 255, 0}, {107, 255, 0}, {100, 255, 0}, {92, 255, 0}, {84, 255, 0}, {77, 255, 49}, {69, 255, 115}, {61, 255, 181}, {54, 255, 246}, {46, 255, 255}, {38, 255, 255}, {31, 255, 255}, {23, 255, 255}, {15, 255, 255}, {8, 255, 255}},
+        {{129, 255, 0}, {121, 255, 0}, {113, 255, 0}, {106, 255, 0}, {98, 255, 0}, {90, 255, 0}, {83, 255, 0}, {75, 255, 6}, {67, 255, 72}, {60, 255, 137}, {52, 255, 203}, {44, 255, 255}, {37, 255, 255}, {29, 255, 255}, {21, 255, 255}, {14, 255, 255}, {6, 255, 255}},
+        {{127, 255, 0}, {120, 255, 0}, {112, 255, 0}, {104, 255, 0}, {96, 255, 0}, {89, 255, 0}, {81, 255, 0}, {73, 255, 0}, {66, 255, 28}, {58, 255, 94}, {50, 255, 160}, {43, 255, 226}, {35, 255, 255}, {27, 255, 255}, {20, 255, 255}, {12, 255, 255}, {5, 255, 255}},
+        {{126, 255, 0}, {118, 255, 0}, {110, 255, 0}, {103, 255, 0}, {95, 255, 0}, {87, 255, 0}, {80, 255, 0}, {72, 255, 0}, {64, 255, 0}, {56, 255, 51}, {49, 255, 117}, {41, 255, 183}, {33, 255, 248}, {26, 255, 255}, {18, 255, 255}, {10, 255, 255}, {3, 255, 255}},
+        {{124, 255, 0}, {116, 255, 0}, {109, 255, 0}, {101, 255, 0}, {93, 255, 0}, {86, 255, 0}, {78, 255, 0}, {70, 255, 0}, {63, 255, 0}, {55, 255, 8}, {47, 255, 74}, {40, 255, 139}, {32, 255, 205}, {24, 255, 255}, {16, 255, 255}, {9, 255, 255}, {2, 255, 255}},
+        {{122, 255, 0}, {115, 255, 0}, {107, 255, 0}, {99, 255, 0}, {92, 255, 0}, {84, 255, 0}, {76, 255, 0}, {69, 255, 0}, {61, 255, 0}, {53, 255, 0}, {46, 255, 30}, {38, 255, 96}, {30, 255, 162}, {23, 255, 228}, {15, 255, 255}, {7, 255, 255}, {0, 255, 255}},
+        {{121, 255, 0}, {113, 255, 0}, {105, 255, 0}, {98, 255, 0}, {90, 255, 0}, {82, 255, 0}, {75, 255, 0}, {67, 255, 0}, {59, 255, 0}, {52, 255, 0}, {44, 255, 0}, {36, 255, 53}, {29, 255, 119}, {21, 255, 184}, {13, 255, 250}, {6, 255, 255}, {0, 255, 255}},
+        {{119, 255, 0}, {112, 255, 0}, {104, 255, 0}, {96, 255, 0}, {89, 255, 0}, {81, 255, 0}, {73, 255, 0}, {66, 255, 0}, {58, 255, 0}, {50, 255, 0}, {43, 255, 0}, {35, 255, 12}, {27, 255, 78}, {19, 255, 144}, {12, 255, 210}, {4, 255, 255}, {0, 255, 255}},
+    },
+    {
+        {{174, 0, 0}, {166, 0, 39}, {158, 0, 105}, {151, 0, 170}, {143, 0, 236}, {135, 0, 255}, {128, 0, 255}, {120, 0, 255}, {112, 0, 255}, {105, 0, 255}, {97, 0, 255}, {89, 0, 255}, {82, 0, 255}, {74, 0, 255}, {66, 0, 255}, {59, 0, 255}, {51, 0, 255}},
+        {{172, 57, 0}, {164, 18, 0}, {157, 0, 61}, {149, 0, 127}, {141, 0, 193}, {134, 0, 255}, {126, 0, 255}, {118, 0, 255}, {111, 0, 255}, {103, 0, 255}, {95, 0, 255}, {88, 0, 255}, {80, 0, 255}, {72, 0, 255}, {65, 0, 255}, {57, 0, 255}, {50, 0, 255}},
+        {{171, 158, 0}, {163, 119, 0}, {155, 81, 18}, {148, 42, 84}, {140, 3, 150}, {132, 0, 216}, {124, 0, 255}, {117, 0, 255}, {109, 0, 255}, {101, 0, 255}, {94, 0, 255}, {86, 0, 255}, {78, 0, 255}, {71, 0, 255}, {63, 0, 255}, {55, 0, 255}, {48, 0, 255}},
+        {{169, 255, 0}, {161, 220, 0}, {154, 182, 0}, {146, 143, 41}, {138, 104, 107}, {131, 66, 172}, {123, 27, 238}, {115, 0, 255}, {108, 0, 255}, {100, 0, 255}, {92, 0, 255}, {84, 0, 255}, {77, 0, 255}, {69, 0, 255}, {61, 0, 255}, {54, 0, 255}, {47, 0, 255}},
+        {{167, 255, 0}, {160, 255, 0}, {152, 255, 0}, {144, 244, 0}, {137, 205, 63}, {129, 167, 129}, {121, 128, 195}, {114, 89, 255}, {106, 51, 255}, {98, 12, 255}, {91, 0, 255}, {83, 0, 255}, {75, 0, 255}, {68, 0, 255}, {60, 0, 255}, {52, 0, 255}, {45, 0, 255}},
+        {{166, 255, 0}, {158, 255, 0}, {150, 255, 0}, {143, 255, 0}, {135, 255, 20}, {127, 255, 86}, {120, 229, 152}, {112, 190, 217}, {104, 152, 255}, {97, 113, 255}, {89, 74, 255}, {81, 36, 255}, {74, 0, 255}, {66, 0, 255}, {58, 0, 255}, {51, 0, 255}, {43, 0, 255}},
+        {{164, 255, 0}, {156, 255, 0}, {149, 255, 0}, {141, 255, 0}, {133, 255, 0}, {126, 255, 43}, {118, 255, 108}, {110, 255, 174}, {103, 253, 240}, {95, 214, 255}, {87, 175, 255}, {80, 137, 255}, {72, 98, 255}, {64, 59, 255}, {57, 20, 255}, {49, 0, 255}, {42, 0, 255}},
+        {{163, 255, 0}, {155, 255, 0}, {147, 255, 0}, {140, 255, 0}, {132, 255, 0}, {124, 255, 0}, {116, 255, 65}, {109, 255, 131}, {101, 255, 197}, {93, 255, 255}, {86, 255, 255}, {78, 238, 255}, {70, 199, 255}, {63, 160, 255}, {55, 122, 255}, {47, 83, 255}, {40, 47, 255}},
+        {{161, 255, 0}, {153, 255, 0}, {146, 255, 0}, {138, 255, 0}, {130, 255, 0}, {123, 255, 0}, {115, 255, 22}, {107, 255, 88}, {100, 255, 154}, {92, 255, 219}, {84, 255, 255}, {76, 255, 255}, {69, 255, 255}, {61, 255, 255}, {53, 223, 255}, {46, 184, 255}, {39, 148, 255}},
+        {{159, 255, 0}, {152, 255, 0}, {144, 255, 0}, {136, 255, 0}, {129, 255, 0}, {121, 255, 0}, {113, 255, 0}, {106, 255, 45}, {98, 255, 110}, {90, 255, 176}, {83, 255, 242}, {75, 255, 255}, {67, 255, 255}, {60, 255, 255}, {52, 255, 255}, {44, 255, 255}, {37, 249, 255}},
+        {{158, 255, 0}, {150, 255, 0}, {142, 255, 0}, {135, 255, 0}, {127, 255, 0}, {119, 255, 0}, {112, 255, 0}, {104, 255, 1}, {96, 255, 67}, {89, 255, 133}, {81, 255, 199}, {73, 255, 255}, {66, 255, 255}, {58, 255, 255}, {50, 255, 255}, {43, 255, 255}, {35, 255, 255}},
+        {{156, 255, 0}, {148, 255, 0}, {141, 255, 0}, {133, 255, 0}, {125, 255, 0}, {118, 255, 0}, {110, 255, 0}, {102, 255, 0}, {95, 255, 24}, {87, 255, 90}, {79, 255, 156}, {72, 255, 221}, {64, 255, 255}, {56, 255, 255}, {49, 255, 255}, {41, 255, 255}, {34, 255, 255}},
+        {{155, 255, 0}, {147, 255, 0}, {139, 255, 0}, {132, 255, 0}, {124, 255, 0}, {116, 255, 0}, {108, 255, 0}, {101, 255, 0}, {93, 255, 0}, {85, 255, 47}, {78, 255, 112}, {70, 255, 178}, {62, 255, 244}, {55, 255, 255}, {47, 255, 255}, {39, 255, 255}, {32, 255, 255}},
+        {{153, 255, 0}, {145, 255, 0}, {138, 255, 0}, {130, 255, 0}, {122, 255, 0}, {115, 255, 0}, {107, 255, 0}, {99, 255, 0}, {92, 255, 0}, {84, 255, 3}, {76, 255, 69}, {68, 255, 135}, {61, 255, 201}, {53, 255, 255}, {45, 255, 255}, {38, 255, 255}, {31, 255, 255}},
+        {{151, 255, 0}, {144, 255, 0}, {136, 255, 0}, {128, 255, 0}, {121, 255, 0}, {113, 255, 0}, {105, 255, 0}, {98, 255, 0}, {90, 255, 0}, {82, 255, 0}, {75, 255, 26}, {67, 255, 92}, {59, 255, 157}, {52, 255, 223}, {44, 255, 255}, {36, 255, 255}, {29, 255, 255}},
+        {{150, 255, 0}, {142, 255, 0}, {134, 255, 0}, {127, 255, 0}, {119, 255, 0}, {111, 255, 0}, {104, 255, 0}, {96, 255, 0}, {88, 255, 0}, {81, 255, 0}, {73, 255, 0}, {65, 255, 48}, {58, 255, 114}, {50, 255, 180}, {42, 255, 246}, {35, 255, 255}, {27, 255, 255}},
+        {{148, 255, 0}, {141, 255, 0}, {133, 255, 0}, {125, 255, 0}, {118, 255, 0}, {110, 255, 0}, {102, 255, 0}, {94, 255, 0}, {87, 255, 0}, {79, 255, 0}, {71, 255, 0}, {64, 255, 8}, {56, 255, 74}, {48, 255, 140}, {41, 255, 205}, {33, 255, 255}, {26, 255, 255}},
+    },
+    {
+        {{203, 0, 0}, {195, 0, 34}, {187, 0, 100}, {180, 0, 166}, {172, 0, 232}, {164, 0, 255}, {157, 0, 255}, {149, 0, 255}, {141, 0, 255}, {134, 0, 255}, {126, 0, 255}, {118, 0, 255}, {111, 0, 255}, {103, 0, 255}, {95, 0, 255}, {88, 0, 255}, {80, 0, 255}},
+        {{201, 50, 0}, {193, 11, 0}, {186, 0, 57}, {178, 0, 123}, {170, 0, 188}, {163, 0, 254}, {155, 0, 255}, {147, 0, 255}, {140, 0, 255}, {132, 0, 255}, {124, 0, 255}, {117, 0, 255}, {109, 0, 255}, {101, 0, 255}, {94, 0, 255}, {86, 0, 255}, {79, 0, 255}},
+        {{200, 151, 0}, {192, 112, 0}, {184, 73, 14}, {176, 35, 80}, {169, 0, 145}, {161, 0, 211}, {153, 0, 255}, {146, 0, 255}, {138, 0, 255}, {130, 0, 255}, {123, 0, 255}, {115, 0, 255}, {107, 0, 255}, {100, 0, 255}, {92, 0, 255}, {84, 0, 255}, {77, 0, 255}},
+        {{198, 252, 0}, {190, 213, 0}, {183, 174, 0}, {175, 136, 36}, {167, 97, 102}, {160, 58, 168}, {152, 20, 234}, {144, 0, 255}, {136, 0, 255}, {129, 0, 255}, {121, 0, 255}, {113, 0, 255}, {106, 0, 255}, {98, 0, 255}, {90, 0, 255}, {83, 0, 255}, {76, 0, 255}},
+        {{196, 255, 0}, {189, 255, 0}, {181, 255, 0}, {173, 237, 0}, {166, 198, 59}, {158, 159, 125}, {150, 121, 190}, {143, 82, 255}, {135, 43, 255}, {127, 4, 255}, {120, 0, 255}, {112, 0, 255}, {104, 0, 255}, {96, 0, 255}, {89, 0, 255}, {81, 0, 255}, {74, 0, 255}},
+        {{195, 255, 0}, {187, 255, 0}, {179, 255, 0}, {172, 255, 0}, {164, 255, 16}, {156, 255, 81}, {149, 222, 147}, {141, 183, 213}, {133, 144, 255}, {126, 106, 255}, {118, 67, 255}, {110, 28, 255}, {103, 0, 255}, {95, 0, 255}, {87, 0, 255}, {80, 0, 255}, {72, 0, 255}},
+        {{193, 255, 0}, {185, 255, 0}, {178, 255, 0}, {170, 255, 0}, {162, 255, 0}, {155, 255, 38}, {147, 255, 104}, {139, 255, 170}, {132, 245, 236}, {124, 207, 255}, {116, 168, 255}, {109, 129, 255}, {101, 91, 255}, {93, 52, 255}, {86, 13, 255}, {78, 0, 255}, {71, 0, 255}},
+        {{192, 255, 0}, {184, 255, 0}, {176, 255, 0}, {168, 255, 0}, {161, 255, 0}, {153, 255, 0}, {145, 255, 61}, {138, 255, 127}, {130, 255, 192}, {122, 255, 255}, {115, 255, 255}, {107, 230, 255}, {99, 192, 255}, {92, 153, 255}, {84, 114, 255}, {76, 76, 255}, {69, 39, 255}},
+        {{190, 255, 0}, {182, 255, 0}, {175, 255, 0}, {167, 255, 0}, {159, 255, 0}, {152, 255, 0}, {144, 255, 18}, {136, 255, 83}, {128, 255, 149}, {121, 255, 215}, {113, 255, 255}, {105, 255, 255}, {98, 255, 255}, {90, 254, 255}, {82, 215, 255}, {75, 177, 255}, {68, 140, 255}},
+        {{188, 255, 0}, {181, 255, 0}, {173, 255, 0}, {165, 255, 0}, {158, 255, 0}, {150, 255, 0}, {142, 255, 0}, {135, 255, 40}, {127, 255, 106}, {119, 255, 172}, {112, 255, 237}, {104, 255, 255}, {96, 255, 255}, {88, 255, 255}, {81, 255, 255}, {73, 255, 255}, {66, 241, 255}},
+        {{187, 255, 0}, {179, 255, 0}, {171, 255, 0}, {164, 255, 0}, {156, 255, 0}, {148, 255, 0}, {141, 255, 0}, {133, 255, 0}, {125, 255, 63}, {118, 255, 128}, {110, 255, 194}, {102, 255, 255}, {95, 255, 255}, {87, 255, 255}, {79, 255, 255}, {72, 255, 255}, {64, 255, 255}},
+        {{185, 255, 0}, {177, 255, 0}, {170, 255, 0}, {162, 255, 0}, {154, 255, 0}, {147, 255, 0}, {139, 255, 0}, {131, 255, 0}, {124, 255, 20}, {116, 255, 85}, {108, 255, 151}, {101, 255, 217}, {93, 255, 255}, {85, 255, 255}, {78, 255, 255}, {70, 255, 255}, {63, 255, 255}},
+        {{184, 255, 0}, {176, 255, 0}, {168, 255, 0}, {160, 255, 0}, {153, 255, 0}, {145, 255, 0}, {137, 255, 0}, {130, 255, 0}, {122, 255, 0}, {114, 255, 42}, {107, 255, 108}, {99, 255, 174}, {91, 255, 239}, {84, 255, 255}, {76, 255, 255}, {68, 255, 255}, {61, 255, 255}},
+        {{182, 255, 0}, {174, 255, 0}, {167, 255, 0}, {159, 255, 0}, {151, 255, 0}, {144, 255, 0}, {136, 255, 0}, {128, 255, 0}, {120, 255, 0}, {113, 255, 0}, {105, 255, 65}, {97, 255, 130}, {90, 255, 196}, {82, 255, 255}, {74, 255, 255}, {67, 255, 255}, {60, 255, 255}},
+        {{180, 255, 0}, {173, 255, 0}, {165, 255, 0}, {157, 255, 0}, {150, 255, 0}, {142, 255, 0}, {134, 255, 0}, {127, 255, 0}, {119, 255, 0}, {111, 255, 0}, {104, 255, 21}, {96, 255, 87}, {88, 255, 153}, {80, 255, 219}, {73, 255, 255}, {65, 255, 255}, {58, 255, 255}},
+        {{179, 255, 0}, {171, 255, 0}, {163, 255, 0}, {156, 255, 0}, {148, 255, 0}, {140, 255, 0}, {133, 255, 0}, {125, 255, 0}, {117, 255, 0}, {110, 255, 0}, {102, 255, 0}, {94, 255, 44}, {87, 255, 110}, {79, 255, 176}, {71, 255, 241}, {64, 255, 255}, {56, 255, 255}},
+        {{177, 255, 0}, {170, 255, 0}, {162, 255, 0}, {154, 255, 0}, {146, 255, 0}, {139, 255, 0}, {131, 255, 0}, {123, 255, 0}, {116, 255, 0}, {108, 255, 0}, {100, 255, 0}, {93, 255, 4}, {85, 255, 69}, {77, 255, 135}, {70, 255, 201}, {62, 255, 255}, {55, 255, 255}},
+    },
+    {
+        {{232, 0, 0}, {224, 0, 30}, {216, 0, 96}, {209, 0, 161}, {201, 0, 227}, {193, 0, 255}, {186, 0, 255}, {178, 0, 255}, {170, 0, 255}, {163, 0, 255}, {155, 0, 255}, {147, 0, 255}, {140, 0, 255}, {132, 0, 255}, {124, 0, 255}, {116, 0, 255}, {109, 0, 255}},
+        {{230, 42, 0}, {222, 4, 0}, {215, 0, 52}, {207, 0, 118}, {199, 0, 184}, {192, 0, 250}, {184, 0, 255}, {176, 0, 255}, {169, 0, 255}, {161, 0, 255}, {153, 0, 255}, {146, 0, 255}, {138, 0, 255}, {130, 0, 255}, {123, 0, 255}, {115, 0, 255}, {108, 0, 255}},
+        {{228, 143, 0}, {221, 105, 0}, {213, 66, 9}, {205, 27, 75}, {198, 0, 141}, {190, 0, 207}, {182, 0, 255}, {175, 0, 255}, {167, 0, 255}, {159, 0, 255}, {152, 0, 255}, {144, 0, 255}, {136, 0, 255}, {129, 0, 255}, {121, 0, 255}, {113, 0, 255}, {106, 0, 255}},
+        {{227, 244, 0}, {219, 206, 0}, {212, 167, 0}, {204, 128, 32}, {196, 90, 98}, {188, 51, 163}, {181, 12, 229}, {173, 0, 255}, {165, 0, 255}, {158, 0, 255}, {150, 0, 255}, {142, 0, 255}, {135, 0, 255}, {127, 0, 255}, {119, 0, 255}, {112, 0, 255}, {104, 0, 255}},
+        {{225, 255, 0}, {218, 255, 0}, {210, 255, 0}, {202, 229, 0}, {195, 191, 54}, {187, 152, 120}, {179, 113, 186}, {172, 75, 252}, {164, 36, 255}, {156, 0, 255}, {148, 0, 255}, {141, 0, 255}, {133, 0, 255}, {125, 0, 255}, {118, 0, 255}, {110, 0, 255}, {103, 0, 255}},
+        {{224, 255, 0}, {216, 255, 0}, {208, 255, 0}, {201, 255, 0}, {193, 255, 11}, {185, 253, 77}, {178, 214, 143}, {170, 176, 208}, {162, 137, 255}, {155, 98, 255}, {147, 60, 255}, {139, 21, 255}, {132, 0, 255}, {124, 0, 255}, {116, 0, 255}, {108, 0, 255}, {101, 0, 255}},
+        {{222, 255, 0}, {214, 255, 0}, {207, 255, 0}, {199, 255, 0}, {191, 255, 0}, {184, 255, 34}, {176, 255, 100}, {168, 255, 165}, {161, 238, 231}, {153, 199, 255}, {145, 161, 255}, {138, 122, 255}, {130, 83, 255}, {122, 44, 255}, {115, 6, 255}, {107, 0, 255}, {100, 0, 255}},
+        {{220, 255, 0}, {213, 255, 0}, {205, 255, 0}, {197, 255, 0}, {190, 255, 0}, {182, 255, 0}, {174, 255, 56}, {167, 255, 122}, {159, 255, 188}, {151, 255, 254}, {144, 255, 255}, {136, 223, 255}, {128, 184, 255}, {121, 146, 255}, {113, 107, 255}, {105, 68, 255}, {98, 32, 255}},
+        {{219, 255, 0}, {211, 255, 0}, {204, 255, 0}, {196, 255, 0}, {188, 255, 0}, {180, 255, 0}, {173, 255, 13}, {165, 255, 79}, {157, 255, 145}, {150, 255, 210}, {142, 255, 255}, {134, 255, 255}, {127, 255, 255}, {119, 247, 255}, {111, 208, 255}, {104, 169, 255}, {96, 133, 255}},
+        {{217, 255, 0}, {210, 255, 0}, {202, 255, 0}, {194, 255, 0}, {187, 255, 0}, {179, 255, 0}, {171, 255, 0}, {164, 255, 36}, {156, 255, 101}, {148, 255, 167}, {140, 255, 233}, {133, 255, 255}, {125, 255, 255}, {117, 255, 255}, {110, 255, 255}, {102, 255, 255}, {95, 234, 255}},
+        {{216, 255, 0}, {208, 255, 0}, {200, 255, 0}, {193, 255, 0}, {185, 255, 0}, {177, 255, 0}, {170, 255, 0}, {162, 255, 0}, {154, 255, 58}, {147, 255, 124}, {139, 255, 190}, {131, 255, 255}, {124, 255, 255}, {116, 255, 255}, {108, 255, 255}, {100, 255, 255}, {93, 255, 255}},
+        {{214, 255, 0}, {206, 255, 0}, {199, 255, 0}, {191, 255, 0}, {183, 255, 0}, {176, 255, 0}, {168, 255, 0}, {160, 255, 0}, {153, 255, 15}, {145, 255, 81}, {137, 255, 147}, {130, 255, 212}, {122, 255, 255}, {114, 255, 255}, {107, 255, 255}, {99, 255, 255}, {92, 255, 255}},
+        {{212, 255, 0}, {205, 255, 0}, {197, 255, 0}, {189, 255, 0}, {182, 255, 0}, {174, 255, 0}, {166, 255, 0}, {159, 255, 0}, {151, 255, 0}, {143, 255, 38}, {136, 255, 103}, {128, 255, 169}, {120, 255, 235}, {113, 255, 255}, {105, 255, 255}, {97, 255, 255}, {90, 255, 255}},
+        {{211, 255, 0}, {203, 255, 0}, {196, 255, 0}, {188, 255, 0}, {180, 255, 0}, {172, 255, 0}, {165, 255, 0}, {157, 255, 0}, {149, 255, 0}, {142, 255, 0}, {134, 255, 60}, {126, 255, 126}, {119, 255, 192}, {111, 255, 255}, {103, 255, 255}, {96, 255, 255}, {88, 255, 255}},
+        {{209, 255, 0}, {202, 255, 0}, {194, 255, 0}, {186, 255, 0}, {179, 255, 0}, {171, 255, 0}, {163, 255, 0}, {156, 255, 0}, {148, 255, 0}, {140, 255, 0}, {132, 255, 17}, {125, 255, 83}, {117, 255, 148}, {109, 255, 214}, {102, 255, 255}, {94, 255, 255}, {87, 255, 255}},
+        {{208, 255, 0}, {200, 255, 0}, {192, 255, 0}, {185, 255, 0}, {177, 255, 0}, {169, 255, 0}, {162, 255, 0}, {154, 255, 0}, {146, 255, 0}, {139, 255, 0}, {131, 255, 0}, {123, 255, 40}, {116, 255, 105}, {108, 255, 171}, {100, 255, 237}, {92, 255, 255}, {85, 255, 255}},
+        {{206, 255, 0}, {198, 255, 0}, {191, 255, 0}, {183, 255, 0}, {175, 255, 0}, {168, 255, 0}, {160, 255, 0}, {152, 255, 0}, {145, 255, 0}, {137, 255, 0}, {129, 255, 0}, {122, 255, 0}, {114, 255, 65}, {106, 255, 131}, {99, 255, 196}, {91, 255, 255}, {84, 255, 255}},
+    },
+    {
+        {{255, 0, 0}, {253, 0, 25}, {245, 0, 91}, {238, 0, 157}, {230, 0, 223}, {222, 0, 255}, {215, 0, 255}, {207, 0, 255}, {199, 0, 255}, {192, 0, 255}, {184, 0, 255}, {176, 0, 255}, {168, 0, 255}, {161, 0, 255}, {153, 0, 255}, {145, 0, 255}, {138, 0, 255}},
+        {{255, 35, 0}, {251, 0, 0}, {244, 0, 48}, {236, 0, 114}, {228, 0, 180}, {221, 0, 245}, {213, 0, 255}, {205, 0, 255}, {198, 0, 255}, {190, 0, 255}, {182, 0, 255}, {175, 0, 255}, {167, 0, 255}, {159, 0, 255}, {152, 0, 255}, {144, 0, 255}, {137, 0, 255}},
+        {{255, 136, 0}, {250, 97, 0}, {242, 59, 5}, {234, 20, 71}, {227, 0, 136}, {219, 0, 202}, {211, 0, 255}, {204, 0, 255}, {196, 0, 255}, {188, 0, 255}, {181, 0, 255}, {173, 0, 255}, {165, 0, 255}, {158, 0, 255}, {150, 0, 255}, {142, 0, 255}, {135, 0, 255}},
+        {{255, 237, 0}, {248, 198, 0}, {240, 160, 0}, {233, 121, 27}, {225, 82, 93}, {217, 44, 159}, {210, 5, 225}, {202, 0, 255}, {194, 0, 255}, {187, 0, 255}, {179, 0, 255}, {171, 0, 255}, {164, 0, 255}, {156, 0, 255}, {148, 0, 255}, {141, 0, 255}, {133, 0, 255}},
+        {{254, 255, 0}, {247, 255, 0}, {239, 255, 0}, {231, 222, 0}, {224, 183, 50}, {216, 145, 116}, {208, 106, 181}, {200, 67, 247}, {193, 28, 255}, {185, 0, 255}, {177, 0, 255}, {170, 0, 255}, {162, 0, 255}, {154, 0, 255}, {147, 0, 255}, {139, 0, 255}, {132, 0, 255}},
+        {{253, 255, 0}, {245, 255, 0}, {237, 255, 0}, {230, 255, 0}, {222, 255, 7}, {214, 246, 72}, {207, 207, 138}, {199, 168, 204}, {191, 130, 255}, {184, 91, 255}, {176, 52, 255}, {168, 13, 255}, {160, 0, 255}, {153, 0, 255}, {145, 0, 255}, {137, 0, 255}, {130, 0, 255}},
+        {{251, 255, 0}, {243, 255, 0}, {236, 255, 0}, {228, 255, 0}, {220, 255, 0}, {213, 255, 29}, {205, 255, 95}, {197, 255, 161}, {190, 231, 227}, {182, 192, 255}, {174, 153, 255}, {167, 115, 255}, {159, 76, 255}, {151, 37, 255}, {144, 0, 255}, {136, 0, 255}, {129, 0, 255}},
+        {{249, 255, 0}, {242, 255, 0}, {234, 255, 0}, {226, 255, 0}, {219, 255, 0}, {211, 255, 0}, {203, 255, 52}, {196, 255, 118}, {188, 255, 183}, {180, 255, 249}, {173, 254, 255}, {165, 216, 255}, {157, 177, 255}, {150, 138, 255}, {142, 100, 255}, {134, 61, 255}, {127, 24, 255}},
+        {{248, 255, 0}, {240, 255, 0}, {232, 255, 0}, {225, 255, 0}, {217, 255, 0}, {209, 255, 0}, {202, 255, 9}, {194, 255, 74}, {186, 255, 140}, {179, 255, 206}, {171, 255, 255}, {163, 255, 255}, {156, 255, 255}, {148, 239, 255}, {140, 201, 255}, {133, 162, 255}, {125, 126, 255}},
+        {{246, 255, 0}, {239, 255, 0}, {231, 255, 0}, {223, 255, 0}, {216, 255, 0}, {208, 255, 0}, {200, 255, 0}, {192, 255, 31}, {185, 255, 97}, {177, 255, 163}, {169, 255, 228}, {162, 255, 255}, {154, 255, 255}, {146, 255, 255}, {139, 255, 255}, {131, 255, 255}, {124, 227, 255}},
+        {{245, 255, 0}, {237, 255, 0}, {229, 255, 0}, {222, 255, 0}, {214, 255, 0}, {206, 255, 0}, {199, 255, 0}, {191, 255, 0}, {183, 255, 54}, {176, 255, 120}, {168, 255, 185}, {160, 255, 251}, {152, 255, 255}, {145, 255, 255}, {137, 255, 255}, {129, 255, 255}, {122, 255, 255}},
+        {{243, 255, 0}, {235, 255, 0}, {228, 255, 0}, {220, 255, 0}, {212, 255, 0}, {205, 255, 0}, {197, 255, 0}, {189, 255, 0}, {182, 255, 11}, {174, 255, 76}, {166, 255, 142}, {159, 255, 208}, {151, 255, 255}, {143, 255, 255}, {136, 255, 255}, {128, 255, 255}, {121, 255, 255}},
+        {{241, 255, 0}, {234, 255, 0}, {226, 255, 0}, {218, 255, 0}, {211, 255, 0}, {203, 255, 0}, {195, 255, 0}, {188, 255, 0}, {180, 255, 0}, {172, 255, 33}, {165, 255, 99}, {157, 255, 165}, {149, 255, 230}, {142, 255, 255}, {134, 255, 255}, {126, 255, 255}, {119, 255, 255}},
+        {{240, 255, 0}, {232, 255, 0}, {224, 255, 0}, {217, 255, 0}, {209, 255, 0}, {201, 255, 0}, {194, 255, 0}, {186, 255, 0}, {178, 255, 0}, {171, 255, 0}, {163, 255, 56}, {155, 255, 121}, {148, 255, 187}, {140, 255, 253}, {132, 255, 255}, {125, 255, 255}, {117, 255, 255}},
+        {{238, 255, 0}, {231, 255, 0}, {223, 255, 0}, {215, 255, 0}, {208, 255, 0}, {200, 255, 0}, {192, 255, 0}, {184, 255, 0}, {177, 255, 0}, {169, 255, 0}, {161, 255, 12}, {154, 255, 78}, {146, 255, 144}, {138, 255, 210}, {131, 255, 255}, {123, 255, 255}, {116, 255, 255}},
+        {{237, 255, 0}, {229, 255, 0}, {221, 255, 0}, {214, 255, 0}, {206, 255, 0}, {198, 255, 0}, {191, 255, 0}, {183, 255, 0}, {175, 255, 0}, {168, 255, 0}, {160, 255, 0}, {152, 255, 35}, {144, 255, 101}, {137, 255, 167}, {129, 255, 232}, {121, 255, 255}, {114, 255, 255}},
+        {{235, 255, 0}, {227, 255, 0}, {220, 255, 0}, {212, 255, 0}, {204, 255, 0}, {197, 255, 0}, {189, 255, 0}, {181, 255, 0}, {174, 255, 0}, {166, 255, 0}, {158, 255, 0}, {151, 255, 0}, {143, 255, 60}, {135, 255, 126}, {128, 255, 192}, {120, 255, 255}, {113, 255, 255}},
+    },
+    {
+        {{255, 0, 0}, {255, 0, 21}, {255, 0, 87}, {255, 0, 152}, {255, 0, 218}, {251, 0, 255}, {244, 0, 255}, {236, 0, 255}, {228, 0, 255}, {220, 0, 255}, {213, 0, 255}, {205, 0, 255}, {197, 0, 255}, {190, 0, 255}, {182, 0, 255}, {174, 0, 255}, {167, 0, 255}},
+        {{255, 28, 0}, {255, 0, 0}, {255, 0, 44}, {255, 0, 109}, {255, 0, 175}, {250, 0, 241}, {242, 0, 255}, {234, 0, 255}, {227, 0, 255}, {219, 0, 255}, {211, 0, 255}, {204, 0, 255}, {196, 0, 255}, {188, 0, 255}, {180, 0, 255}, {173, 0, 255}, {166, 0, 255}},
+        {{255, 129, 0}, {255, 90, 0}, {255, 51, 0}, {255, 12, 66}, {255, 0, 132}, {248, 0, 198}, {240, 0, 255}, {233, 0, 255}, {225, 0, 255}, {217, 0, 255}, {210, 0, 255}, {202, 0, 255}, {194, 0, 255}, {187, 0, 255}, {179, 0, 255}, {171, 0, 255}, {164, 0, 255}},
+        {{255, 230, 0}, {255, 191, 0}, {255, 152, 0}, {255, 114, 23}, {254, 75, 89}, {246, 36, 154}, {239, 0, 220}, {231, 0, 255}, {223, 0, 255}, {216, 0, 255}, {208, 0, 255}, {200, 0, 255}, {193, 0, 255}, {185, 0, 255}, {177, 0, 255}, {170, 0, 255}, {162, 0, 255}},
+        {{255, 255, 0}, {255, 255, 0}, {255, 253, 0}, {255, 215, 0}, {252, 176, 45}, {245, 137, 111}, {237, 99, 177}, {229, 60, 243}, {222, 21, 255}, {214, 0, 255}, {206, 0, 255}, {199, 0, 255}, {191, 0, 255}, {183, 0, 255}, {176, 0, 255}, {168, 0, 255}, {161, 0, 255}},
+        {{255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {251, 255, 2}, {243, 238, 68}, {236, 200, 134}, {228, 161, 200}, {220, 122, 255}, {212, 84, 255}, {205, 45, 255}, {197, 6, 255}, {189, 0, 255}, {182, 0, 255}, {174, 0, 255}, {166, 0, 255}, {159, 0, 255}},
+        {{255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {249, 255, 0}, {242, 255, 25}, {234, 255, 91}, {226, 255, 156}, {219, 223, 222}, {211, 185, 255}, {203, 146, 255}, {196, 107, 255}, {188, 68, 255}, {180, 30, 255}, {172, 0, 255}, {165, 0, 255}, {158, 0, 255}},
+        {{255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {248, 255, 0}, {240, 255, 0}, {232, 255, 47}, {225, 255, 113}, {217, 255, 179}, {209, 255, 245}, {202, 247, 255}, {194, 208, 255}, {186, 170, 255}, {179, 131, 255}, {171, 92, 255}, {163, 53, 255}, {156, 17, 255}},
+        {{255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {254, 255, 0}, {246, 255, 0}, {238, 255, 0}, {231, 255, 4}, {223, 255, 70}, {215, 255, 136}, {208, 255, 201}, {200, 255, 255}, {192, 255, 255}, {185, 255, 255}, {177, 232, 255}, {169, 193, 255}, {162, 155, 255}, {154, 118, 255}},
+        {{255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {252, 255, 0}, {244, 255, 0}, {237, 255, 0}, {229, 255, 0}, {221, 255, 27}, {214, 255, 92}, {206, 255, 158}, {198, 255, 224}, {191, 255, 255}, {183, 255, 255}, {175, 255, 255}, {168, 255, 255}, {160, 255, 255}, {153, 219, 255}},
+        {{255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {251, 255, 0}, {243, 255, 0}, {235, 255, 0}, {228, 255, 0}, {220, 255, 0}, {212, 255, 49}, {204, 255, 115}, {197, 255, 181}, {189, 255, 247}, {181, 255, 255}, {174, 255, 255}, {166, 255, 255}, {158, 255, 255}, {151, 255, 255}},
+        {{255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {249, 255, 0}, {241, 255, 0}, {234, 255, 0}, {226, 255, 0}, {218, 255, 0}, {211, 255, 6}, {203, 255, 72}, {195, 255, 138}, {188, 255, 203}, {180, 255, 255}, {172, 255, 255}, {164, 255, 255}, {157, 255, 255}, {150, 255, 255}},
+        {{255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {247, 255, 0}, {240, 255, 0}, {232, 255, 0}, {224, 255, 0}, {217, 255, 0}, {209, 255, 0}, {201, 255, 29}, {194, 255, 94}, {186, 255, 160}, {178, 255, 226}, {171, 255, 255}, {163, 255, 255}, {155, 255, 255}, {148, 255, 255}},
+        {{255, 255, 0}, {255, 255, 0}, {253, 255, 0}, {246, 255, 0}, {238, 255, 0}, {230, 255, 0}, {223, 255, 0}, {215, 255, 0}, {207, 255, 0}, {200, 255, 0}, {192, 255, 51}, {184, 255, 117}, {177, 255, 183}, {169, 255, 248}, {161, 255, 255}, {154, 255, 255}, {146, 255, 255}},
+        {{255, 255, 0}, {255, 255, 0}, {252, 255, 0}, {244, 255, 0}, {236, 255, 0}, {229, 255, 0}, {221, 255, 0}, {213, 255, 0}, {206, 255, 0}, {198, 255, 0}, {190, 255, 8}, {183, 255, 74}, {175, 255, 140}, {167, 255, 205}, {160, 255, 255}, {152, 255, 255}, {145, 255, 255}},
+        {{255, 255, 0}, {255, 255, 0}, {250, 255, 0}, {243, 255, 0}, {235, 255, 0}, {227, 255, 0}, {220, 255, 0}, {212, 255, 0}, {204, 255, 0}, {196, 255, 0}, {189, 255, 0}, {181, 255, 31}, {173, 255, 96}, {166, 255, 162}, {158, 255, 228}, {150, 255, 255}, {143, 255, 255}},
+        {{255, 255, 0}, {255, 255, 0}, {249, 255, 0}, {241, 255, 0}, {233, 255, 0}, {226, 255, 0}, {218, 255, 0}, {210, 255, 0}, {203, 255, 0}, {195, 255, 0}, {187, 255, 0}, {180, 255, 0}, {172, 255, 56}, {164, 255, 122}, {157, 255, 187}, {149, 255, 253}, {142, 255, 255}},
+    },
+    {
+        {{255, 0, 0}, {255, 0, 16}, {255, 0, 82}, {255, 0, 148}, {255, 0, 214}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {249, 0, 255}, {242, 0, 255}, {234, 0, 255}, {226, 0, 255}, {219, 0, 255}, {211, 0, 255}, {203, 0, 255}, {196, 0, 255}},
+        {{255, 20, 0}, {255, 0, 0}, {255, 0, 39}, {255, 0, 105}, {255, 0, 171}, {255, 0, 236}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {248, 0, 255}, {240, 0, 255}, {232, 0, 255}, {225, 0, 255}, {217, 0, 255}, {209, 0, 255}, {202, 0, 255}, {195, 0, 255}},
+        {{255, 121, 0}, {255, 83, 0}, {255, 44, 0}, {255, 5, 62}, {255, 0, 127}, {255, 0, 193}, {255, 0, 255}, {255, 0, 255}, {254, 0, 255}, {246, 0, 255}, {239, 0, 255}, {231, 0, 255}, {223, 0, 255}, {216, 0, 255}, {208, 0, 255}, {200, 0, 255}, {193, 0, 255}},
+        {{255, 222, 0}, {255, 184, 0}, {255, 145, 0}, {255, 106, 18}, {255, 68, 84}, {255, 29, 150}, {255, 0, 216}, {255, 0, 255}, {252, 0, 255}, {245, 0, 255}, {237, 0, 255}, {229, 0, 255}, {222, 0, 255}, {214, 0, 255}, {206, 0, 255}, {199, 0, 255}, {191, 0, 255}},
+        {{255, 255, 0}, {255, 255, 0}, {255, 246, 0}, {255, 207, 0}, {255, 169, 41}, {255, 130, 107}, {255, 91, 172}, {255, 52, 238}, {251, 14, 255}, {243, 0, 255}, {235, 0, 255}, {228, 0, 255}, {220, 0, 255}, {212, 0, 255}, {205, 0, 255}, {197, 0, 255}, {190, 0, 255}},
+        {{255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 231, 64}, {255, 192, 129}, {255, 154, 195}, {249, 115, 255}, {241, 76, 255}, {234, 37, 255}, {226, 0, 255}, {218, 0, 255}, {211, 0, 255}, {203, 0, 255}, {195, 0, 255}, {188, 0, 255}},
+        {{255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 20}, {255, 255, 86}, {255, 255, 152}, {248, 216, 218}, {240, 177, 255}, {232, 139, 255}, {224, 100, 255}, {217, 61, 255}, {209, 22, 255}, {201, 0, 255}, {194, 0, 255}, {187, 0, 255}},
+        {{255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 43}, {254, 255, 109}, {246, 255, 174}, {238, 255, 240}, {231, 240, 255}, {223, 201, 255}, {215, 162, 255}, {208, 124, 255}, {200, 85, 255}, {192, 46, 255}, {185, 10, 255}},
+        {{255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {252, 255, 65}, {244, 255, 131}, {237, 255, 197}, {229, 255, 255}, {221, 255, 255}, {214, 255, 255}, {206, 225, 255}, {198, 186, 255}, {191, 147, 255}, {183, 111, 255}},
+        {{255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {250, 255, 22}, {243, 255, 88}, {235, 255, 154}, {227, 255, 220}, {220, 255, 255}, {212, 255, 255}, {204, 255, 255}, {197, 255, 255}, {189, 248, 255}, {182, 212, 255}},
+        {{255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {249, 255, 0}, {241, 255, 45}, {233, 255, 111}, {226, 255, 176}, {218, 255, 242}, {210, 255, 255}, {203, 255, 255}, {195, 255, 255}, {187, 255, 255}, {180, 255, 255}},
+        {{255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {247, 255, 0}, {240, 255, 2}, {232, 255, 67}, {224, 255, 133}, {216, 255, 199}, {209, 255, 255}, {201, 255, 255}, {193, 255, 255}, {186, 255, 255}, {179, 255, 255}},
+        {{255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {253, 255, 0}, {246, 255, 0}, {238, 255, 0}, {230, 255, 24}, {223, 255, 90}, {215, 255, 156}, {207, 255, 221}, {200, 255, 255}, {192, 255, 255}, {184, 255, 255}, {177, 255, 255}},
+        {{255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {252, 255, 0}, {244, 255, 0}, {236, 255, 0}, {229, 255, 0}, {221, 255, 47}, {213, 255, 112}, {206, 255, 178}, {198, 255, 244}, {190, 255, 255}, {183, 255, 255}, {175, 255, 255}},
+        {{255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {250, 255, 0}, {242, 255, 0}, {235, 255, 0}, {227, 255, 0}, {219, 255, 4}, {212, 255, 69}, {204, 255, 135}, {196, 255, 201}, {189, 255, 255}, {181, 255, 255}, {174, 255, 255}},
+        {{255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {248, 255, 0}, {241, 255, 0}, {233, 255, 0}, {225, 255, 0}, {218, 255, 0}, {210, 255, 26}, {202, 255, 92}, {195, 255, 158}, {187, 255, 223}, {179, 255, 255}, {172, 255, 255}},
+        {{255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {247, 255, 0}, {239, 255, 0}, {232, 255, 0}, {224, 255, 0}, {216, 255, 0}, {209, 255, 0}, {201, 255, 51}, {193, 255, 117}, {186, 255, 183}, {178, 255, 249}, {171, 255, 255}},
+    },
+    {
+        {{255, 0, 0}, {255, 0, 12}, {255, 0, 78}, {255, 0, 144}, {255, 0, 209}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {248, 0, 255}, {240, 0, 255}, {232, 0, 255}, {225, 0, 255}},
+        {{255, 13, 0}, {255, 0, 0}, {255, 0, 35}, {255, 0, 100}, {255, 0, 166}, {255, 0, 232}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {254, 0, 255}, {246, 0, 255}, {238, 0, 255}, {231, 0, 255}, {224, 0, 255}},
+        {{255, 114, 0}, {255, 75, 0}, {255, 36, 0}, {255, 0, 57}, {255, 0, 123}, {255, 0, 189}, {255, 0, 254}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {252, 0, 255}, {244, 0, 255}, {237, 0, 255}, {229, 0, 255}, {222, 0, 255}},
+        {{255, 215, 0}, {255, 176, 0}, {255, 138, 0}, {255, 99, 14}, {255, 60, 80}, {255, 21, 145}, {255, 0, 211}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {251, 0, 255}, {243, 0, 255}, {235, 0, 255}, {228, 0, 255}, {220, 0, 255}},
+        {{255, 255, 0}, {255, 255, 0}, {255, 239, 0}, {255, 200, 0}, {255, 161, 36}, {255, 123, 102}, {255, 84, 168}, {255, 45, 234}, {255, 6, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {249, 0, 255}, {241, 0, 255}, {234, 0, 255}, {226, 0, 255}, {219, 0, 255}},
+        {{255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 224, 59}, {255, 185, 125}, {255, 146, 191}, {255, 108, 255}, {255, 69, 255}, {255, 30, 255}, {255, 0, 255}, {247, 0, 255}, {240, 0, 255}, {232, 0, 255}, {224, 0, 255}, {217, 0, 255}},
+        {{255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 16}, {255, 255, 82}, {255, 247, 147}, {255, 209, 213}, {255, 170, 255}, {255, 131, 255}, {253, 92, 255}, {246, 54, 255}, {238, 15, 255}, {230, 0, 255}, {223, 0, 255}, {216, 0, 255}},
+        {{255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 38}, {255, 255, 104}, {255, 255, 170}, {255, 255, 236}, {255, 232, 255}, {252, 194, 255}, {244, 155, 255}, {236, 116, 255}, {229, 77, 255}, {221, 39, 255}, {214, 2, 255}},
+        {{255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 61}, {255, 255, 127}, {255, 255, 192}, {255, 255, 255}, {250, 255, 255}, {243, 255, 255}, {235, 217, 255}, {227, 179, 255}, {220, 140, 255}, {212, 104, 255}},
+        {{255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 18}, {255, 255, 84}, {255, 255, 149}, {255, 255, 215}, {249, 255, 255}, {241, 255, 255}, {233, 255, 255}, {226, 255, 255}, {218, 241, 255}, {211, 205, 255}},
+        {{255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 40}, {255, 255, 106}, {255, 255, 172}, {247, 255, 238}, {239, 255, 255}, {232, 255, 255}, {224, 255, 255}, {216, 255, 255}, {209, 255, 255}},
+        {{255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 63}, {253, 255, 129}, {245, 255, 194}, {238, 255, 255}, {230, 255, 255}, {222, 255, 255}, {215, 255, 255}, {208, 255, 255}},
+        {{255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 20}, {252, 255, 85}, {244, 255, 151}, {236, 255, 217}, {228, 255, 255}, {221, 255, 255}, {213, 255, 255}, {206, 255, 255}},
+        {{255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {250, 255, 42}, {242, 255, 108}, {235, 255, 174}, {227, 255, 240}, {219, 255, 255}, {212, 255, 255}, {204, 255, 255}},
+        {{255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {248, 255, 0}, {241, 255, 65}, {233, 255, 131}, {225, 255, 196}, {218, 255, 255}, {210, 255, 255}, {203, 255, 255}},
+        {{255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {254, 255, 0}, {247, 255, 0}, {239, 255, 22}, {231, 255, 87}, {224, 255, 153}, {216, 255, 219}, {208, 255, 255}, {201, 255, 255}},
+        {{255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {253, 255, 0}, {245, 255, 0}, {238, 255, 0}, {230, 255, 47}, {222, 255, 113}, {214, 255, 178}, {207, 255, 244}, {200, 255, 255}},
+    },
+    {
+        {{255, 0, 0}, {255, 0, 8}, {255, 0, 73}, {255, 0, 139}, {255, 0, 205}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {254, 0, 255}},
+        {{255, 5, 0}, {255, 0, 0}, {255, 0, 30}, {255, 0, 96}, {255, 0, 162}, {255, 0, 227}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {252, 0, 255}},
+        {{255, 107, 0}, {255, 68, 0}, {255, 29, 0}, {255, 0, 53}, {255, 0, 118}, {255, 0, 184}, {255, 0, 250}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {251, 0, 255}},
+        {{255, 208, 0}, {255, 169, 0}, {255, 130, 0}, {255, 92, 9}, {255, 53, 75}, {255, 14, 141}, {255, 0, 207}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {249, 0, 255}},
+        {{255, 255, 0}, {255, 255, 0}, {255, 231, 0}, {255, 193, 0}, {255, 154, 32}, {255, 115, 98}, {255, 76, 164}, {255, 38, 229}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {248, 0, 255}},
+        {{255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 216, 55}, {255, 178, 120}, {255, 139, 186}, {255, 100, 252}, {255, 61, 255}, {255, 23, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {253, 0, 255}, {246, 0, 255}},
+        {{255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 11}, {255, 255, 77}, {255, 240, 143}, {255, 201, 209}, {255, 163, 255}, {255, 124, 255}, {255, 85, 255}, {255, 46, 255}, {255, 8, 255}, {255, 0, 255}, {252, 0, 255}, {244, 0, 255}},
+        {{255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 34}, {255, 255, 100}, {255, 255, 165}, {255, 255, 231}, {255, 225, 255}, {255, 186, 255}, {255, 148, 255}, {255, 109, 255}, {255, 70, 255}, {250, 31, 255}, {243, 0, 255}},
+        {{255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 56}, {255, 255, 122}, {255, 255, 188}, {255, 255, 254}, {255, 255, 255}, {255, 249, 255}, {255, 210, 255}, {255, 171, 255}, {248, 132, 255}, {241, 96, 255}},
+        {{255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 13}, {255, 255, 79}, {255, 255, 145}, {255, 255, 211}, {255, 255, 255}, {255, 255, 255}, {255, 255, 255}, {255, 255, 255}, {247, 234, 255}, {240, 197, 255}},
+        {{255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 36}, {255, 255, 102}, {255, 255, 167}, {255, 255, 233}, {255, 255, 255}, {255, 255, 255}, {253, 255, 255}, {245, 255, 255}, {238, 255, 255}},
+        {{255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 58}, {255, 255, 124}, {255, 255, 190}, {255, 255, 255}, {255, 255, 255}, {251, 255, 255}, {244, 255, 255}, {236, 255, 255}},
+        {{255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 15}, {255, 255, 81}, {255, 255, 147}, {255, 255, 212}, {255, 255, 255}, {250, 255, 255}, {242, 255, 255}, {235, 255, 255}},
+        {{255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 38}, {255, 255, 104}, {255, 255, 169}, {255, 255, 235}, {248, 255, 255}, {240, 255, 255}, {233, 255, 255}},
+        {{255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 60}, {255, 255, 126}, {254, 255, 192}, {247, 255, 255}, {239, 255, 255}, {232, 255, 255}},
+        {{255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 17}, {255, 255, 83}, {253, 255, 149}, {245, 255, 214}, {237, 255, 255}, {230, 255, 255}},
+        {{255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 42}, {251, 255, 108}, {243, 255, 174}, {236, 255, 240}, {229, 255, 255}},
+    },
+    {
+        {{255, 0, 0}, {255, 0, 3}, {255, 0, 69}, {255, 0, 135}, {255, 0, 200}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}},
+        {{255, 0, 0}, {255, 0, 0}, {255, 0, 26}, {255, 0, 91}, {255, 0, 157}, {255, 0, 223}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}},
+        {{255, 99, 0}, {255, 60, 0}, {255, 22, 0}, {255, 0, 48}, {255, 0, 114}, {255, 0, 180}, {255, 0, 245}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}},
+        {{255, 200, 0}, {255, 162, 0}, {255, 123, 0}, {255, 84, 5}, {255, 45, 71}, {255, 7, 136}, {255, 0, 202}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}},
+        {{255, 255, 0}, {255, 255, 0}, {255, 224, 0}, {255, 185, 0}, {255, 147, 28}, {255, 108, 93}, {255, 69, 159}, {255, 30, 225}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}},
+        {{255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 248, 0}, {255, 209, 50}, {255, 170, 116}, {255, 132, 182}, {255, 93, 247}, {255, 54, 255}, {255, 15, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}},
+        {{255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 7}, {255, 255, 73}, {255, 233, 138}, {255, 194, 204}, {255, 155, 255}, {255, 116, 255}, {255, 78, 255}, {255, 39, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}},
+        {{255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 29}, {255, 255, 95}, {255, 255, 161}, {255, 255, 227}, {255, 218, 255}, {255, 179, 255}, {255, 140, 255}, {255, 101, 255}, {255, 63, 255}, {255, 24, 255}, {255, 0, 255}},
+        {{255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 52}, {255, 255, 118}, {255, 255, 184}, {255, 255, 249}, {255, 255, 255}, {255, 241, 255}, {255, 203, 255}, {255, 164, 255}, {255, 125, 255}, {255, 89, 255}},
+        {{255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 9}, {255, 255, 75}, {255, 255, 140}, {255, 255, 206}, {255, 255, 255}, {255, 255, 255}, {255, 255, 255}, {255, 255, 255}, {255, 226, 255}, {255, 190, 255}},
+        {{255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 31}, {255, 255, 97}, {255, 255, 163}, {255, 255, 229}, {255, 255, 255}, {255, 255, 255}, {255, 255, 255}, {255, 255, 255}, {255, 255, 255}},
+        {{255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 54}, {255, 255, 120}, {255, 255, 185}, {255, 255, 251}, {255, 255, 255}, {255, 255, 255}, {255, 255, 255}, {255, 255, 255}},
+        {{255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 11}, {255, 255, 76}, {255, 255, 142}, {255, 255, 208}, {255, 255, 255}, {255, 255, 255}, {255, 255, 255}, {255, 255, 255}},
+        {{255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 33}, {255, 255, 99}, {255, 255, 165}, {255, 255, 231}, {255, 255, 255}, {255, 255, 255}, {255, 255, 255}},
+        {{255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 56}, {255, 255, 122}, {255, 255, 187}, {255, 255, 253}, {255, 255, 255}, {255, 255, 255}},
+        {{255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 13}, {255, 255, 78}, {255, 255, 144}, {255, 255, 210}, {255, 255, 255}, {255, 255, 255}},
+        {{255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 38}, {255, 255, 104}, {255, 255, 169}, {255, 255, 235}, {255, 255, 255}},
+    },
+    {
+        {{255, 0, 0}, {255, 0, 0}, {255, 0, 64}, {255, 0, 130}, {255, 0, 196}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}},
+        {{255, 0, 0}, {255, 0, 0}, {255, 0, 21}, {255, 0, 87}, {255, 0, 153}, {255, 0, 218}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}},
+        {{255, 92, 0}, {255, 53, 0}, {255, 14, 0}, {255, 0, 44}, {255, 0, 109}, {255, 0, 175}, {255, 0, 241}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}},
+        {{255, 193, 0}, {255, 154, 0}, {255, 116, 0}, {255, 77, 0}, {255, 38, 66}, {255, 0, 132}, {255, 0, 198}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}},
+        {{255, 255, 0}, {255, 255, 0}, {255, 217, 0}, {255, 178, 0}, {255, 139, 23}, {255, 100, 89}, {255, 62, 155}, {255, 23, 220}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}},
+        {{255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 240, 0}, {255, 202, 46}, {255, 163, 111}, {255, 124, 177}, {255, 85, 243}, {255, 47, 255}, {255, 8, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}},
+        {{255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 2}, {255, 255, 68}, {255, 225, 134}, {255, 187, 200}, {255, 148, 255}, {255, 109, 255}, {255, 70, 255}, {255, 32, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}},
+        {{255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 25}, {255, 255, 91}, {255, 255, 156}, {255, 249, 222}, {255, 210, 255}, {255, 172, 255}, {255, 133, 255}, {255, 94, 255}, {255, 55, 255}, {255, 17, 255}, {255, 0, 255}},
+        {{255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 48}, {255, 255, 113}, {255, 255, 179}, {255, 255, 245}, {255, 255, 255}, {255, 234, 255}, {255, 195, 255}, {255, 156, 255}, {255, 118, 255}, {255, 81, 255}},
+        {{255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 4}, {255, 255, 70}, {255, 255, 136}, {255, 255, 202}, {255, 255, 255}, {255, 255, 255}, {255, 255, 255}, {255, 255, 255}, {255, 219, 255}, {255, 183, 255}},
+        {{255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 27}, {255, 255, 93}, {255, 255, 158}, {255, 255, 224}, {255, 255, 255}, {255, 255, 255}, {255, 255, 255}, {255, 255, 255}, {255, 255, 255}},
+        {{255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 49}, {255, 255, 115}, {255, 255, 181}, {255, 255, 247}, {255, 255, 255}, {255, 255, 255}, {255, 255, 255}, {255, 255, 255}},
+        {{255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 6}, {255, 255, 72}, {255, 255, 138}, {255, 255, 204}, {255, 255, 255}, {255, 255, 255}, {255, 255, 255}, {255, 255, 255}},
+        {{255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 29}, {255, 255, 95}, {255, 255, 160}, {255, 255, 226}, {255, 255, 255}, {255, 255, 255}, {255, 255, 255}},
+        {{255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 51}, {255, 255, 117}, {255, 255, 183}, {255, 255, 249}, {255, 255, 255}, {255, 255, 255}},
+        {{255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 8}, {255, 255, 74}, {255, 255, 140}, {255, 255, 205}, {255, 255, 255}, {255, 255, 255}},
+        {{255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 33}, {255, 255, 99}, {255, 255, 165}, {255, 255, 231}, {255, 255, 255}},
+    },
+    {
+        {{255, 0, 0}, {255, 0, 0}, {255, 0, 60}, {255, 0, 126}, {255, 0, 192}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}},
+        {{255, 0, 0}, {255, 0, 0}, {255, 0, 17}, {255, 0, 83}, {255, 0, 148}, {255, 0, 214}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}},
+        {{255, 85, 0}, {255, 46, 0}, {255, 8, 0}, {255, 0, 39}, {255, 0, 105}, {255, 0, 171}, {255, 0, 237}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}},
+        {{255, 186, 0}, {255, 147, 0}, {255, 109, 0}, {255, 70, 0}, {255, 31, 62}, {255, 0, 128}, {255, 0, 194}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}},
+        {{255, 255, 0}, {255, 248, 0}, {255, 210, 0}, {255, 171, 0}, {255, 132, 19}, {255, 94, 85}, {255, 55, 150}, {255, 16, 216}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}},
+        {{255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 233, 0}, {255, 195, 41}, {255, 156, 107}, {255, 117, 173}, {255, 79, 239}, {255, 40, 255}, {255, 1, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}},
+        {{255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 64}, {255, 218, 130}, {255, 180, 195}, {255, 141, 255}, {255, 102, 255}, {255, 64, 255}, {255, 25, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}, {255, 0, 255}},
+        {{255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 21}, {255, 255, 87}, {255, 255, 152}, {255, 242, 218}, {255, 203, 255}, {255, 165, 255}, {255, 126, 255}, {255, 87, 255}, {255, 48, 255}, {255, 10, 255}, {255, 0, 255}},
+        {{255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 43}, {255, 255, 109}, {255, 255, 175}, {255, 255, 241}, {255, 255, 255}, {255, 227, 255}, {255, 188, 255}, {255, 150, 255}, {255, 111, 255}, {255, 75, 255}},
+        {{255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 66}, {255, 255, 132}, {255, 255, 197}, {255, 255, 255}, {255, 255, 255}, {255, 255, 255}, {255, 251, 255}, {255, 212, 255}, {255, 176, 255}},
+        {{255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 23}, {255, 255, 88}, {255, 255, 154}, {255, 255, 220}, {255, 255, 255}, {255, 255, 255}, {255, 255, 255}, {255, 255, 255}, {255, 255, 255}},
+        {{255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 45}, {255, 255, 111}, {255, 255, 177}, {255, 255, 243}, {255, 255, 255}, {255, 255, 255}, {255, 255, 255}, {255, 255, 255}},
+        {{255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 2}, {255, 255, 68}, {255, 255, 134}, {255, 255, 199}, {255, 255, 255}, {255, 255, 255}, {255, 255, 255}, {255, 255, 255}},
+        {{255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 25}, {255, 255, 90}, {255, 255, 156}, {255, 255, 222}, {255, 255, 255}, {255, 255, 255}, {255, 255, 255}},
+        {{255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 47}, {255, 255, 113}, {255, 255, 179}, {255, 255, 244}, {255, 255, 255}, {255, 255, 255}},
+        {{255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 4}, {255, 255, 70}, {255, 255, 135}, {255, 255, 201}, {255, 255, 255}, {255, 255, 255}},
+        {{255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 0}, {255, 255, 29}, {255, 255, 95}, {255, 255, 161}, {255, 255, 227}, {255, 255, 255}},
+    },
+};
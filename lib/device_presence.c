@@ -0,0 +1,115 @@
+#include <stdio.h>
+#include "device_presence.h"
+
+// Probe de endereço: leitura de um byte, só o ACK importa
+static bool dev_presence_probe(dev_presence_t *dev)
+{
+    uint8_t byte;
+    return i2c_read_timeout_us(dev->i2c, dev->addr, &byte, 1, false, DEV_PRESENCE_TIMEOUT_US) == 1;
+}
+
+static void dev_presence_set_offline(dev_presence_t *dev)
+{
+    dev->online = false;
+    dev->lost++;
+    dev->backoff_ms = DEV_PRESENCE_BACKOFF_MIN_MS;
+    dev->next_probe_us = time_us_64() + DEV_PRESENCE_BACKOFF_MIN_MS * 1000ull;
+}
+
+static bool dev_presence_set_online(dev_presence_t *dev)
+{
+    dev->online = true;
+    dev->fails = 0;
+    if (dev->on_online && !dev->on_online(dev))
+    {
+        dev_presence_set_offline(dev);
+        return false;
+    }
+    return true;
+}
+
+bool dev_presence_init(dev_presence_t *dev, const char *name, i2c_inst_t *i2c, uint8_t addr,
+                       dev_presence_online_fn on_online)
+{
+    *dev = (dev_presence_t){
+        .name = name,
+        .i2c = i2c,
+        .addr = addr,
+        .on_online = on_online,
+    };
+    if (dev_presence_probe(dev))
+    {
+        // A configuração inicial é do driver: o callback é só para reconexões
+        dev->online = true;
+        return true;
+    }
+    dev_presence_set_offline(dev);
+    dev->lost = 0;
+    return false;
+}
+
+bool dev_presence_ready(dev_presence_t *dev)
+{
+    if (dev->online)
+        return true;
+
+    uint64_t now = time_us_64();
+    if (now < dev->next_probe_us)
+        return false;
+
+    dev->probes++;
+    if (dev_presence_probe(dev))
+    {
+        dev->restored++;
+        return dev_presence_set_online(dev);
+    }
+
+    // Espera dobra a cada probe sem resposta, até o teto
+    dev->backoff_ms *= 2;
+    if (dev->backoff_ms > DEV_PRESENCE_BACKOFF_MAX_MS)
+        dev->backoff_ms = DEV_PRESENCE_BACKOFF_MAX_MS;
+    dev->next_probe_us = now + dev->backoff_ms * 1000ull;
+    return false;
+}
+
+static bool dev_presence_account(dev_presence_t *dev, bool ok)
+{
+    if (ok)
+    {
+        dev->fails = 0;
+        return true;
+    }
+    dev->errors++;
+    if (++dev->fails >= DEV_PRESENCE_FAIL_LIMIT)
+        dev_presence_set_offline(dev);
+    return false;
+}
+
+bool dev_presence_write(dev_presence_t *dev, const uint8_t *src, size_t len, bool nostop)
+{
+    if (!dev_presence_ready(dev))
+    {
+        dev->skipped++;
+        return false;
+    }
+    int n = i2c_write_timeout_us(dev->i2c, dev->addr, src, len, nostop, DEV_PRESENCE_TIMEOUT_US);
+    return dev_presence_account(dev, n == (int)len);
+}
+
+bool dev_presence_read(dev_presence_t *dev, uint8_t *dst, size_t len, bool nostop)
+{
+    if (!dev_presence_ready(dev))
+    {
+        dev->skipped++;
+        return false;
+    }
+    int n = i2c_read_timeout_us(dev->i2c, dev->addr, dst, len, nostop, DEV_PRESENCE_TIMEOUT_US);
+    return dev_presence_account(dev, n == (int)len);
+}
+
+void dev_presence_report(const dev_presence_t *dev)
+{
+    printf("%s (0x%02X): %s, %lu erros, %lu quedas, %lu reconexões, %lu probes, %lu transações evitadas\n",
+           dev->name, dev->addr, dev->online ? "presente" : "ausente", dev->errors, dev->lost,
+           dev->restored, dev->probes, dev->skipped);
+}
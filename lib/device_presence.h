@@ -0,0 +1,87 @@
+#ifndef DEVICE_PRESENCE_H
+#define DEVICE_PRESENCE_H
+
+#include "pico/stdlib.h"
+#include "hardware/i2c.h"
+
+/**
+ * @brief Presença de um dispositivo I2C (sensor que pode ser desconectado).
+ *
+ * Toda transação do driver passa por aqui, com timeout. Falhas seguidas
+ * (NAK ou timeout) marcam o dispositivo como ausente; a partir daí as
+ * transações retornam falha na hora, sem tocar no barramento, e um probe de
+ * endereço é tentado com espera exponencial entre as tentativas. Quando o
+ * dispositivo volta, o callback do driver reaplica a configuração antes da
+ * próxima transação.
+ *
+ * O dono do barramento chama as funções (loop principal ou a interrupção
+ * da aquisição); não há trava interna nem printf - o loop acompanha as
+ * mudanças por dev_presence_online().
+ */
+
+#define DEV_PRESENCE_TIMEOUT_US 5000   // Por transação: folga sobre 17 bytes a 100 kHz
+#define DEV_PRESENCE_FAIL_LIMIT 3      // Falhas seguidas até marcar ausente
+#define DEV_PRESENCE_BACKOFF_MIN_MS 100
+#define DEV_PRESENCE_BACKOFF_MAX_MS 10000
+
+typedef struct dev_presence dev_presence_t;
+
+/**
+ * @brief Chamado ao detectar o dispositivo de volta (já marcado presente).
+ *
+ * Roda dentro da transação que fez o probe: o driver deve tratar como "sem
+ * dados" as leituras até a primeira medida completa depois da reconexão.
+ *
+ * @return false se a reconfiguração falhou; o dispositivo volta a ausente.
+ */
+typedef bool (*dev_presence_online_fn)(dev_presence_t *dev);
+
+struct dev_presence
+{
+    const char *name;
+    i2c_inst_t *i2c;
+    uint8_t addr;
+    bool online;
+    uint8_t fails;       // Falhas seguidas
+    uint32_t backoff_ms; // Espera até o próximo probe
+    uint64_t next_probe_us;
+    dev_presence_online_fn on_online;
+
+    // Contadores
+    uint32_t errors;    // Transações com NAK ou timeout
+    uint32_t lost;      // Passagens para ausente
+    uint32_t restored;  // Reconexões
+    uint32_t probes;    // Probes com o dispositivo ausente
+    uint32_t skipped;   // Transações evitadas com o dispositivo ausente
+};
+
+/**
+ * @brief Inicializa e faz o probe de boot; o resultado define o estado inicial.
+ *
+ * @return true se o dispositivo respondeu.
+ */
+bool dev_presence_init(dev_presence_t *dev, const char *name, i2c_inst_t *i2c, uint8_t addr,
+                       dev_presence_online_fn on_online);
+
+/**
+ * @brief true se o dispositivo pode ser usado agora. Ausente, faz o probe
+ *        quando a espera vence; fora disso custa só uma comparação de tempo.
+ */
+bool dev_presence_ready(dev_presence_t *dev);
+
+/**
+ * @brief Escrita/leitura com timeout e contabilização da presença.
+ *
+ * @return true se todos os bytes foram transferidos.
+ */
+bool dev_presence_write(dev_presence_t *dev, const uint8_t *src, size_t len, bool nostop);
+bool dev_presence_read(dev_presence_t *dev, uint8_t *dst, size_t len, bool nostop);
+
+static inline bool dev_presence_online(const dev_presence_t *dev)
+{
+    return dev->online;
+}
+
+void dev_presence_report(const dev_presence_t *dev);
+
+#endif // DEVICE_PRESENCE_H
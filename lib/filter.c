@@ -0,0 +1,112 @@
+#include "filter.h"
+
+void filter_init(filter_t *filter, filter_type_t type, uint8_t param)
+{
+    if (type == FILTER_EMA)
+    {
+        if (param < 1)
+            param = 1;
+        if (param > 15)
+            param = 15;
+    }
+    else if (type == FILTER_BOXCAR || type == FILTER_MEDIAN)
+    {
+        if (param < 1)
+            param = 1;
+        if (param > FILTER_MAX_WINDOW)
+            param = FILTER_MAX_WINDOW;
+    }
+    filter->type = type;
+    filter->param = param;
+    filter_reset(filter);
+}
+
+void filter_reset(filter_t *filter)
+{
+    filter->count = 0;
+    filter->head = 0;
+    filter->acc = 0;
+}
+
+// EMA: acc guarda o valor filtrado escalado por 2^shift, então cada amostra
+// custa um shift, uma subtração e uma soma
+static int32_t filter_ema(filter_t *filter, int32_t sample)
+{
+    uint8_t shift = filter->param;
+    if (filter->count == 0)
+    {
+        filter->acc = sample * (1 << shift);
+        filter->count = 1;
+    }
+    else
+    {
+        filter->acc += sample - (filter->acc >> shift);
+    }
+    return (filter->acc + (1 << (shift - 1))) >> shift;
+}
+
+// Média móvel: soma corrente, entra uma amostra e sai a mais antiga
+static int32_t filter_boxcar(filter_t *filter, int32_t sample)
+{
+    if (filter->count == filter->param)
+        filter->acc -= filter->ring[filter->head];
+    else
+        filter->count++;
+
+    filter->ring[filter->head] = sample;
+    filter->acc += sample;
+    filter->head = (filter->head + 1) % filter->param;
+
+    return filter->acc / filter->count;
+}
+
+// Mediana: remove da cópia ordenada a amostra que sai da janela e
+// insere a nova na posição certa (deslocamento de no máximo 'janela' itens)
+static int32_t filter_median(filter_t *filter, int32_t sample)
+{
+    int32_t *sorted = filter->sorted;
+    uint8_t n = filter->count;
+
+    if (n == filter->param)
+    {
+        int32_t oldest = filter->ring[filter->head];
+        uint8_t i = 0;
+        while (sorted[i] != oldest)
+            i++;
+        for (; i + 1 < n; i++)
+            sorted[i] = sorted[i + 1];
+        n--;
+    }
+
+    uint8_t pos = n;
+    while (pos > 0 && sorted[pos - 1] > sample)
+    {
+        sorted[pos] = sorted[pos - 1];
+        pos--;
+    }
+    sorted[pos] = sample;
+    n++;
+
+    filter->count = n;
+    filter->ring[filter->head] = sample;
+    filter->head = (filter->head + 1) % filter->param;
+
+    if (n & 1)
+        return sorted[n / 2];
+    return (sorted[n / 2 - 1] + sorted[n / 2]) / 2;
+}
+
+int32_t filter_update(filter_t *filter, int32_t sample)
+{
+    switch (filter->type)
+    {
+    case FILTER_EMA:
+        return filter_ema(filter, sample);
+    case FILTER_BOXCAR:
+        return filter_boxcar(filter, sample);
+    case FILTER_MEDIAN:
+        return filter_median(filter, sample);
+    default:
+        return sample;
+    }
+}
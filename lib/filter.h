@@ -0,0 +1,50 @@
+#ifndef FILTER_H
+#define FILTER_H
+
+#include "pico/stdlib.h"
+
+// Maior janela suportada pela média móvel e pela mediana
+#define FILTER_MAX_WINDOW 16
+
+typedef enum
+{
+    FILTER_NONE,   // Passa a amostra adiante sem alteração
+    FILTER_EMA,    // Média exponencial em ponto fixo, alfa = 1 / 2^param
+    FILTER_BOXCAR, // Média móvel de 'param' amostras, O(1) por amostra
+    FILTER_MEDIAN  // Mediana móvel de 'param' amostras sobre anel + cópia ordenada
+} filter_type_t;
+
+/**
+ * @brief Estado de um filtro de um canal. Sem alocação: tudo vive na struct.
+ */
+typedef struct
+{
+    filter_type_t type;
+    uint8_t param;                      // Janela (boxcar/mediana) ou shift (EMA)
+    uint8_t count;                      // Amostras válidas na janela
+    uint8_t head;                       // Próxima posição do anel
+    int32_t acc;                        // EMA: valor << shift; boxcar: soma da janela
+    int32_t ring[FILTER_MAX_WINDOW];    // Amostras em ordem de chegada
+    int32_t sorted[FILTER_MAX_WINDOW];  // Mediana: mesma janela, ordenada
+} filter_t;
+
+/**
+ * @brief Configura o filtro e descarta o histórico.
+ *
+ * @param param Janela (1..FILTER_MAX_WINDOW) para boxcar/mediana, ou shift (1..15) para EMA.
+ */
+void filter_init(filter_t *filter, filter_type_t type, uint8_t param);
+
+/**
+ * @brief Descarta o histórico mantendo a configuração (ex.: após recalibrar).
+ */
+void filter_reset(filter_t *filter);
+
+/**
+ * @brief Processa uma amostra e retorna a saída filtrada.
+ *
+ * Enquanto a janela enche, a saída usa as amostras disponíveis.
+ */
+int32_t filter_update(filter_t *filter, int32_t sample);
+
+#endif // FILTER_H
@@ -0,0 +1,79 @@
+#include "fmt.h"
+
+// Desenha da direita para a esquerda um campo que começa na coluna 'x'.
+// 'sign' é desenhado antes do primeiro dígito quando diferente de 0.
+// 'point' > 0 insere um '.' depois de 'point' dígitos fracionários.
+static uint8_t fmt_draw_digits(ssd1306_t *ssd, uint8_t x, uint8_t y, uint32_t value, uint8_t width,
+                               char pad, char sign, uint8_t point)
+{
+    // Conta os caracteres para saber onde o campo termina
+    uint8_t count = 0;
+    uint32_t v = value;
+    do
+    {
+        count++;
+        v /= 10;
+    } while (v != 0);
+    if (point > 0)
+    {
+        if (count <= point)
+            count = point + 1; // Zero à esquerda do ponto: "0.05"
+        count++;               // O próprio ponto
+    }
+    if (sign)
+        count++;
+
+    uint8_t total = count > width ? count : width;
+    uint8_t cx = x + total * FMT_CHAR_WIDTH;
+    uint8_t end = cx;
+    uint8_t emitted = 0;
+
+    do
+    {
+        cx -= FMT_CHAR_WIDTH;
+        ssd1306_draw_char(ssd, '0' + value % 10, cx, y);
+        value /= 10;
+        emitted++;
+        if (point > 0 && emitted == point)
+        {
+            cx -= FMT_CHAR_WIDTH;
+            ssd1306_draw_char(ssd, '.', cx, y);
+        }
+    } while (value != 0 || (point > 0 && emitted <= point));
+
+    if (sign)
+    {
+        cx -= FMT_CHAR_WIDTH;
+        ssd1306_draw_char(ssd, sign, cx, y);
+    }
+    while (cx > x)
+    {
+        cx -= FMT_CHAR_WIDTH;
+        ssd1306_draw_char(ssd, pad, cx, y);
+    }
+    return end;
+}
+
+uint8_t fmt_draw_uint(ssd1306_t *ssd, uint8_t x, uint8_t y, uint32_t value, uint8_t width, char pad)
+{
+    return fmt_draw_digits(ssd, x, y, value, width, pad, 0, 0);
+}
+
+uint8_t fmt_draw_int(ssd1306_t *ssd, uint8_t x, uint8_t y, int32_t value, uint8_t width)
+{
+    if (value < 0)
+        return fmt_draw_digits(ssd, x, y, -(uint32_t)value, width, ' ', '-', 0);
+    return fmt_draw_digits(ssd, x, y, (uint32_t)value, width, ' ', 0, 0);
+}
+
+uint8_t fmt_draw_fixed(ssd1306_t *ssd, uint8_t x, uint8_t y, int32_t value, uint8_t frac_digits, uint8_t width)
+{
+    if (frac_digits < 1)
+        frac_digits = 1;
+    if (frac_digits > 4)
+        frac_digits = 4;
+
+    if (value < 0)
+        return fmt_draw_digits(ssd, x, y, -(uint32_t)value, width, ' ', '-', frac_digits);
+    return fmt_draw_digits(ssd, x, y, (uint32_t)value, width, ' ', 0, frac_digits);
+}
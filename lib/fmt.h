@@ -0,0 +1,34 @@
+#ifndef FMT_H
+#define FMT_H
+
+#include "pico/stdlib.h"
+#include "ssd1306.h"
+
+// Largura de um glifo da fonte 8x8
+#define FMT_CHAR_WIDTH 8
+
+/**
+ * @brief Desenha um inteiro sem sinal direto no buffer do display, sem string intermediária.
+ *
+ * Os dígitos são gerados da direita para a esquerda e cada glifo vai direto
+ * para sua coluna final.
+ *
+ * @return Coluna logo após o último caractere desenhado.
+ */
+uint8_t fmt_draw_uint(ssd1306_t *ssd, uint8_t x, uint8_t y, uint32_t value, uint8_t width, char pad);
+
+/**
+ * @brief Como fmt_draw_uint, com sinal '-' colado ao primeiro dígito.
+ */
+uint8_t fmt_draw_int(ssd1306_t *ssd, uint8_t x, uint8_t y, int32_t value, uint8_t width);
+
+/**
+ * @brief Desenha um valor em ponto fixo decimal (ex.: 1234 com 2 casas -> "12.34").
+ *
+ * @param value Valor escalado por 10^frac_digits.
+ * @param frac_digits Casas decimais (1 a 4).
+ * @param width Largura total do campo, incluindo sinal e ponto.
+ */
+uint8_t fmt_draw_fixed(ssd1306_t *ssd, uint8_t x, uint8_t y, int32_t value, uint8_t frac_digits, uint8_t width);
+
+#endif // FMT_H
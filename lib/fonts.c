@@ -0,0 +1,110 @@
+#include "fonts.h"
+
+// Localiza o glifo; retorna NULL se o caractere não está no subconjunto
+static const uint8_t *font_glyph(const font_t *font, char c, uint8_t *width)
+{
+    uint8_t code = (uint8_t)c;
+    if (code < font->first || code > font->last)
+        return NULL;
+    uint8_t index = code - font->first;
+    *width = font->widths[index];
+    if (*width == 0)
+        return NULL;
+    return &font->data[font->offsets[index]];
+}
+
+// Copia uma coluna do glifo para o buffer. Em y alinhado a página são
+// cópias de bytes inteiros; fora do alinhamento, cada byte é dividido
+// entre duas páginas com máscara. 'src' NULL desenha uma coluna em branco.
+static void font_blit_column(ssd1306_t *ssd, uint8_t sx, uint8_t page, uint8_t shift,
+                             const uint8_t *src, uint8_t pages)
+{
+    uint8_t *dst = &ssd->ram_buffer[1 + sx * ssd->pages];
+
+    if (shift == 0)
+    {
+        for (uint8_t k = 0; k < pages && page + k < ssd->pages; k++)
+            dst[page + k] = src ? src[k] : 0x00;
+        return;
+    }
+
+    uint8_t low_mask = 0xFF << shift;         // Bits ocupados na página de cima
+    uint8_t high_mask = 0xFF >> (8 - shift);  // Bits ocupados na página de baixo
+    for (uint8_t k = 0; k < pages; k++)
+    {
+        uint8_t byte = src ? src[k] : 0x00;
+        uint8_t p = page + k;
+        if (p < ssd->pages)
+            dst[p] = (dst[p] & ~low_mask) | (uint8_t)(byte << shift);
+        if (p + 1 < ssd->pages)
+            dst[p + 1] = (dst[p + 1] & ~high_mask) | (byte >> (8 - shift));
+    }
+}
+
+uint8_t font_draw_char(ssd1306_t *ssd, const font_t *font, char c, uint8_t x, uint8_t y)
+{
+    uint8_t width;
+    const uint8_t *glyph = font_glyph(font, c, &width);
+    if (glyph == NULL)
+        return 0;
+
+    uint8_t page = y >> 3;
+    uint8_t shift = y & 0b111;
+    uint8_t advance = width + font->spacing;
+
+    for (uint8_t col = 0; col < advance; col++)
+    {
+        uint16_t sx = x + col;
+        if (sx >= ssd->width)
+            break;
+        const uint8_t *src = col < width ? &glyph[col * font->pages] : NULL;
+        font_blit_column(ssd, sx, page, shift, src, font->pages);
+    }
+    return advance;
+}
+
+uint8_t font_draw_string(ssd1306_t *ssd, const font_t *font, const char *str, uint8_t x, uint8_t y)
+{
+    while (*str && x < ssd->width)
+    {
+        uint16_t next = x + font_draw_char(ssd, font, *str++, x, y);
+        x = next > ssd->width ? ssd->width : next;
+    }
+    return x;
+}
+
+uint8_t font_draw_int(ssd1306_t *ssd, const font_t *font, uint8_t x_end, uint8_t y, int32_t value)
+{
+    uint32_t magnitude = value < 0 ? -(uint32_t)value : (uint32_t)value;
+    uint8_t x = x_end;
+    uint8_t width;
+
+    do
+    {
+        char digit = '0' + magnitude % 10;
+        magnitude /= 10;
+        if (font_glyph(font, digit, &width) == NULL || width + font->spacing > x)
+            return x;
+        x -= width + font->spacing;
+        font_draw_char(ssd, font, digit, x, y);
+    } while (magnitude != 0);
+
+    if (value < 0 && font_glyph(font, '-', &width) != NULL && width + font->spacing <= x)
+    {
+        x -= width + font->spacing;
+        font_draw_char(ssd, font, '-', x, y);
+    }
+    return x;
+}
+
+uint16_t font_text_width(const font_t *font, const char *str)
+{
+    uint16_t total = 0;
+    uint8_t width;
+    while (*str)
+    {
+        if (font_glyph(font, *str++, &width) != NULL)
+            total += width + font->spacing;
+    }
+    return total;
+}
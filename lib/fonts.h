@@ -0,0 +1,60 @@
+#ifndef FONTS_H
+#define FONTS_H
+
+#include "pico/stdlib.h"
+#include "ssd1306.h"
+
+/**
+ * @brief Fonte de largura variável com glifos residentes em flash.
+ *
+ * Os glifos são armazenados já rotacionados, coluna a coluna, com 'pages'
+ * bytes por coluna (bit 0 no topo) - o mesmo layout do ram_buffer. Em y
+ * alinhado a página, cada coluna é copiada direto para o buffer.
+ * Gerados por tools/fontgen.py (ver lib/fonts_data.c).
+ */
+typedef struct
+{
+    uint8_t first;           // Primeiro caractere da tabela
+    uint8_t last;            // Último caractere da tabela
+    uint8_t pages;           // Altura em páginas (8 pixels cada)
+    uint8_t spacing;         // Colunas em branco após cada glifo
+    const uint8_t *widths;   // Largura de cada glifo (0 = ausente no subconjunto)
+    const uint16_t *offsets; // Início de cada glifo em 'data'
+    const uint8_t *data;     // Colunas dos glifos
+} font_t;
+
+// Fonte proporcional de 8 pixels (ASCII completo)
+extern const font_t font_prop8;
+// Dígitos grandes de 16 e 24 pixels (" +-.0123456789")
+extern const font_t font_digits16;
+extern const font_t font_digits24;
+
+/**
+ * @brief Desenha um caractere. Glifos fora da tela são recortados.
+ *
+ * @return Avanço horizontal (largura + espaçamento), 0 se o glifo não existe.
+ */
+uint8_t font_draw_char(ssd1306_t *ssd, const font_t *font, char c, uint8_t x, uint8_t y);
+
+/**
+ * @brief Desenha uma string sem quebra de linha, recortando na borda direita.
+ *
+ * @return Coluna logo após o último caractere.
+ */
+uint8_t font_draw_string(ssd1306_t *ssd, const font_t *font, const char *str, uint8_t x, uint8_t y);
+
+/**
+ * @brief Desenha um inteiro alinhado à direita terminando na coluna 'x_end' (exclusiva).
+ *
+ * Os dígitos são gerados da direita para a esquerda, sem string intermediária.
+ *
+ * @return Coluna do primeiro caractere desenhado.
+ */
+uint8_t font_draw_int(ssd1306_t *ssd, const font_t *font, uint8_t x_end, uint8_t y, int32_t value);
+
+/**
+ * @brief Largura em pixels de uma string nesta fonte.
+ */
+uint16_t font_text_width(const font_t *font, const char *str);
+
+#endif // FONTS_H
@@ -0,0 +1,184 @@
+// Gerado por tools/fontgen.py a partir de lib/font.h - não editar à mão.
+// Glifos pré-rotacionados: para cada coluna, 'pages' bytes (bit 0 no topo).
+
+#include "fonts.h"
+
+static const uint8_t font_prop8_widths[] = {
+    3, 1, 3, 5, 6, 7, 7, 3, 4, 4, 7, 3, 3, 1, 1, 7,
+    7, 4, 5, 4, 4, 5, 5, 6, 5, 5, 1, 3, 5, 1, 5, 6,
+    6, 7, 4, 5, 5, 3, 3, 6, 3, 3, 5, 6, 2, 5, 5, 5,
+    4, 7, 6, 5, 3, 3, 5, 7, 7, 7, 7, 2, 7, 2, 7, 1,
+    3, 5, 4, 5, 4, 5, 6, 5, 4, 3, 5, 6, 3, 6, 4, 5,
+    4, 4, 4, 5, 4, 4, 5, 7, 7, 5, 7, 4, 1, 4, 7,
+};
+
+static const uint16_t font_prop8_offsets[] = {
+    0, 3, 4, 7, 12, 18, 25, 32, 35, 39, 43, 50,
+    53, 56, 57, 58, 65, 72, 76, 81, 85, 89, 94, 99,
+    105, 110, 115, 116, 119, 124, 125, 130, 136, 142, 149, 153,
+    158, 163, 166, 169, 175, 178, 181, 186, 192, 194, 199, 204,
+    209, 213, 220, 226, 231, 234, 237, 242, 249, 256, 263, 270,
+    272, 279, 281, 288, 289, 292, 297, 301, 306, 310, 315, 321,
+    326, 330, 333, 338, 344, 347, 353, 357, 362, 366, 370, 374,
+    379, 383, 387, 392, 399, 406, 411, 418, 422, 423, 427,
+};
+
+static const uint8_t font_prop8_data[] = {
+    0x00, 0x00, 0x00, 0x5F, 0x07, 0x00, 0x07, 0x14, 0x7F, 0x14, 0x7F, 0x14, 0x24, 0x2E, 0x2A, 0x6B,
+    0x3A, 0x12, 0x46, 0x66, 0x30, 0x18, 0x0C, 0x66, 0x62, 0x30, 0x7A, 0x4F, 0x5D, 0x37, 0x7A, 0x48,
+    0x04, 0x07, 0x03, 0x1C, 0x3E, 0x63, 0x41, 0x41, 0x63, 0x3E, 0x1C, 0x08, 0x2A, 0x3E, 0x1C, 0x3E,
+    0x2A, 0x08, 0x08, 0x3E, 0x08, 0x80, 0xE0, 0x60, 0x08, 0x60, 0x60, 0x30, 0x18, 0x0C, 0x06, 0x03,
+    0x01, 0x3E, 0x7F, 0x59, 0x4D, 0x47, 0x7F, 0x3E, 0x40, 0x42, 0x7F, 0x40, 0x72, 0x7B, 0x49, 0x4F,
+    0x46, 0x41, 0x49, 0x7F, 0x36, 0x1E, 0x10, 0x7F, 0x10, 0x27, 0x67, 0x45, 0x7D, 0x39, 0x3E, 0x7F,
+    0x49, 0x79, 0x30, 0x01, 0x61, 0x71, 0x19, 0x0F, 0x07, 0x36, 0x7F, 0x49, 0x7F, 0x36, 0x06, 0x4F,
+    0x49, 0x7F, 0x3E, 0x66, 0x80, 0xE6, 0x66, 0x08, 0x1C, 0x36, 0x63, 0x41, 0x14, 0x41, 0x63, 0x36,
+    0x1C, 0x08, 0x02, 0x03, 0x59, 0x5D, 0x07, 0x02, 0x3E, 0x7F, 0x41, 0x5D, 0x5F, 0x5E, 0x7C, 0x7E,
+    0x13, 0x11, 0x13, 0x7E, 0x7C, 0x7F, 0x49, 0x7F, 0x36, 0x3E, 0x7F, 0x41, 0x63, 0x22, 0x7F, 0x41,
+    0x63, 0x3E, 0x1C, 0x7F, 0x49, 0x41, 0x7F, 0x09, 0x01, 0x3E, 0x7F, 0x41, 0x51, 0x73, 0x32, 0x7F,
+    0x08, 0x7F, 0x41, 0x7F, 0x41, 0x20, 0x60, 0x40, 0x7F, 0x3F, 0x7F, 0x08, 0x1C, 0x36, 0x63, 0x41,
+    0x7F, 0x40, 0x7F, 0x0E, 0x1C, 0x0E, 0x7F, 0x7F, 0x06, 0x0C, 0x18, 0x7F, 0x3E, 0x7F, 0x41, 0x7F,
+    0x3E, 0x7F, 0x09, 0x0F, 0x06, 0x3E, 0x7F, 0x41, 0x71, 0x61, 0xFF, 0xBE, 0x7F, 0x09, 0x19, 0x39,
+    0x6F, 0x46, 0x26, 0x6F, 0x49, 0x7B, 0x32, 0x01, 0x7F, 0x01, 0x7F, 0x40, 0x7F, 0x1F, 0x3F, 0x60,
+    0x3F, 0x1F, 0x3F, 0x7F, 0x60, 0x30, 0x60, 0x7F, 0x3F, 0x63, 0x77, 0x1C, 0x08, 0x1C, 0x77, 0x63,
+    0x47, 0x4F, 0x68, 0x38, 0x18, 0x0F, 0x07, 0x41, 0x61, 0x71, 0x59, 0x4D, 0x47, 0x43, 0x7F, 0x41,
+    0x01, 0x03, 0x06, 0x0C, 0x18, 0x30, 0x60, 0x41, 0x7F, 0x08, 0x0C, 0x06, 0x03, 0x06, 0x0C, 0x08,
+    0x80, 0x03, 0x07, 0x04, 0x20, 0x74, 0x54, 0x7C, 0x78, 0x7F, 0x48, 0x78, 0x30, 0x38, 0x7C, 0x44,
+    0x6C, 0x28, 0x30, 0x78, 0x48, 0x7F, 0x38, 0x7C, 0x54, 0x5C, 0x18, 0x48, 0x7E, 0x7F, 0x49, 0x03,
+    0x02, 0x98, 0xBC, 0xA4, 0xFC, 0x7C, 0x7F, 0x04, 0x7C, 0x78, 0x44, 0x7D, 0x40, 0x40, 0xC0, 0x80,
+    0xFD, 0x7D, 0x7F, 0x10, 0x18, 0x3C, 0x64, 0x40, 0x41, 0x7F, 0x40, 0x7C, 0x18, 0x78, 0x1C, 0x7C,
+    0x78, 0x7C, 0x04, 0x7C, 0x78, 0x38, 0x7C, 0x44, 0x7C, 0x38, 0xFC, 0x24, 0x3C, 0x18, 0x18, 0x3C,
+    0x24, 0xFC, 0x7C, 0x04, 0x0C, 0x08, 0x48, 0x5C, 0x54, 0x74, 0x24, 0x04, 0x3F, 0x7F, 0x44, 0x3C,
+    0x7C, 0x40, 0x7C, 0x1C, 0x3C, 0x60, 0x3C, 0x1C, 0x3C, 0x7C, 0x60, 0x30, 0x60, 0x7C, 0x3C, 0x44,
+    0x6C, 0x38, 0x10, 0x38, 0x6C, 0x44, 0x9C, 0xBC, 0xA0, 0xFC, 0x7C, 0x44, 0x64, 0x74, 0x54, 0x5C,
+    0x4C, 0x44, 0x08, 0x3E, 0x77, 0x41, 0x77, 0x41, 0x77, 0x3E, 0x08, 0x02, 0x03, 0x01, 0x03, 0x02,
+    0x03, 0x01,
+};
+
+const font_t font_prop8 = {
+    .first = 0x20,
+    .last = 0x7E,
+    .pages = 1,
+    .spacing = 1,
+    .widths = font_prop8_widths,
+    .offsets = font_prop8_offsets,
+    .data = font_prop8_data,
+};
+
+static const uint8_t font_digits16_widths[] = {
+    6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12, 0, 12, 4, 0,
+    14, 12, 14, 14, 14, 14, 14, 14, 14, 14,
+};
+
+static const uint16_t font_digits16_offsets[] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12,
+    0, 36, 60, 0, 68, 96, 120, 148, 176, 204, 232, 260,
+    288, 316,
+};
+
+static const uint8_t font_digits16_data[] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0xC0, 0x00,
+    0xC0, 0x00, 0xE0, 0x01, 0xF8, 0x07, 0xFC, 0x0F, 0xFC, 0x0F, 0xF8, 0x07, 0xE0, 0x01, 0xC0, 0x00,
+    0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00,
+    0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0x00, 0x18, 0x00, 0x3C,
+    0x00, 0x3C, 0x00, 0x18, 0xF8, 0x07, 0xFE, 0x1F, 0xFE, 0x1F, 0xFF, 0x3F, 0xC7, 0x33, 0xC3, 0x31,
+    0xE3, 0x31, 0x73, 0x30, 0x3F, 0x30, 0x3F, 0x38, 0xFF, 0x3F, 0xFE, 0x1F, 0xFE, 0x1F, 0xF8, 0x07,
+    0x00, 0x30, 0x00, 0x30, 0x0C, 0x30, 0x1E, 0x38, 0xFE, 0x3F, 0xFF, 0x3F, 0xFF, 0x3F, 0xFE, 0x3F,
+    0x00, 0x38, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x0C, 0x1E, 0x8E, 0x3F, 0x8E, 0x3F, 0xC7, 0x3F,
+    0xC7, 0x39, 0xC3, 0x30, 0xC3, 0x30, 0xC3, 0x30, 0xC3, 0x30, 0xE7, 0x30, 0xFF, 0x30, 0x7E, 0x30,
+    0x7E, 0x30, 0x18, 0x30, 0x03, 0x30, 0x03, 0x30, 0x03, 0x30, 0x03, 0x30, 0xC3, 0x30, 0xC3, 0x30,
+    0xC3, 0x30, 0xC3, 0x30, 0xC3, 0x30, 0xE7, 0x39, 0xFF, 0x3F, 0xFE, 0x1F, 0x3E, 0x1F, 0x18, 0x06,
+    0xF8, 0x01, 0xFC, 0x03, 0xFC, 0x03, 0xF8, 0x03, 0x80, 0x03, 0x00, 0x03, 0x00, 0x03, 0x80, 0x07,
+    0xFE, 0x1F, 0xFF, 0x3F, 0xFF, 0x3F, 0xFE, 0x1F, 0x80, 0x07, 0x00, 0x03, 0x1E, 0x0C, 0x3F, 0x1C,
+    0x3F, 0x1C, 0x3F, 0x38, 0x33, 0x38, 0x33, 0x30, 0x33, 0x30, 0x33, 0x30, 0x33, 0x30, 0x73, 0x38,
+    0xF3, 0x3F, 0xE3, 0x1F, 0xE3, 0x1F, 0x83, 0x07, 0xF8, 0x07, 0xFE, 0x1F, 0xFE, 0x1F, 0xFF, 0x3F,
+    0xE7, 0x39, 0xC3, 0x30, 0xC3, 0x30, 0xC3, 0x30, 0xC3, 0x30, 0xC3, 0x39, 0xC3, 0x3F, 0x83, 0x1F,
+    0x80, 0x1F, 0x00, 0x06, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x18, 0x03, 0x3E,
+    0x03, 0x3E, 0x83, 0x1F, 0x83, 0x07, 0xE7, 0x01, 0xFF, 0x01, 0x7F, 0x00, 0x7F, 0x00, 0x1E, 0x00,
+    0x18, 0x06, 0x3E, 0x1F, 0xFE, 0x1F, 0xFF, 0x3F, 0xE7, 0x39, 0xC3, 0x30, 0xC3, 0x30, 0xC3, 0x30,
+    0xC3, 0x30, 0xE7, 0x39, 0xFF, 0x3F, 0xFE, 0x1F, 0x3E, 0x1F, 0x18, 0x06, 0x18, 0x00, 0x7E, 0x00,
+    0x7E, 0x30, 0xFF, 0x30, 0xE7, 0x30, 0xC3, 0x30, 0xC3, 0x30, 0xC3, 0x30, 0xC3, 0x30, 0xE7, 0x39,
+    0xFF, 0x3F, 0xFE, 0x1F, 0xFE, 0x1F, 0xF8, 0x07,
+};
+
+const font_t font_digits16 = {
+    .first = 0x20,
+    .last = 0x39,
+    .pages = 2,
+    .spacing = 2,
+    .widths = font_digits16_widths,
+    .offsets = font_digits16_offsets,
+    .data = font_digits16_data,
+};
+
+static const uint8_t font_digits24_widths[] = {
+    9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 0, 18, 6, 0,
+    21, 18, 21, 21, 21, 21, 21, 21, 21, 21,
+};
+
+static const uint16_t font_digits24_offsets[] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 27,
+    0, 81, 135, 0, 153, 216, 270, 333, 396, 459, 522, 585,
+    648, 711,
+};
+
+static const uint8_t font_digits24_data[] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E,
+    0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x1F, 0x00, 0x80, 0x3F, 0x00, 0xE0, 0xFF, 0x00,
+    0xF0, 0xFF, 0x01, 0xF8, 0xFF, 0x03, 0xF8, 0xFF, 0x03, 0xF0, 0xFF, 0x01, 0xE0, 0xFF, 0x00, 0x80,
+    0x3F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E,
+    0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00,
+    0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00,
+    0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E,
+    0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x0F, 0x00, 0x80, 0x1F,
+    0x00, 0x80, 0x1F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x06, 0xE0, 0xFF, 0x00, 0xF8, 0xFF, 0x03, 0xFC,
+    0xFF, 0x07, 0xFE, 0xFF, 0x0F, 0xFE, 0xFF, 0x0F, 0xFF, 0xFF, 0x1F, 0x1F, 0x7E, 0x1C, 0x0F, 0x7E,
+    0x1C, 0x07, 0x3E, 0x1C, 0x87, 0x1F, 0x1C, 0xC7, 0x0F, 0x1C, 0xC7, 0x07, 0x1C, 0xFF, 0x01, 0x1C,
+    0xFF, 0x01, 0x1E, 0xFF, 0x01, 0x1F, 0xFF, 0xFF, 0x1F, 0xFE, 0xFF, 0x0F, 0xFE, 0xFF, 0x0F, 0xFC,
+    0xFF, 0x07, 0xF8, 0xFF, 0x03, 0xE0, 0xFF, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00,
+    0x1C, 0x38, 0x00, 0x1C, 0x38, 0x00, 0x1E, 0xFC, 0x00, 0x1F, 0xFE, 0xFF, 0x1F, 0xFE, 0xFF, 0x1F,
+    0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x1F, 0xFE, 0xFF, 0x1F, 0xFC, 0xFF, 0x1F, 0x00, 0x00, 0x1F, 0x00,
+    0x00, 0x1E, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x38, 0xC0,
+    0x07, 0x38, 0xF0, 0x0F, 0x3C, 0xF8, 0x1F, 0x3E, 0xFC, 0x1F, 0x1E, 0xFC, 0x1F, 0x1F, 0xFE, 0x1F,
+    0x0F, 0x3E, 0x1F, 0x0F, 0x1E, 0x1E, 0x07, 0x0E, 0x1C, 0x07, 0x0E, 0x1C, 0x07, 0x0E, 0x1C, 0x07,
+    0x0E, 0x1C, 0x07, 0x0E, 0x1C, 0x0F, 0x0F, 0x1C, 0x9F, 0x0F, 0x1C, 0xFF, 0x0F, 0x1C, 0xFE, 0x07,
+    0x1C, 0xFE, 0x07, 0x1C, 0xFC, 0x03, 0x1C, 0xF8, 0x01, 0x1C, 0x60, 0x00, 0x1C, 0x07, 0x00, 0x1C,
+    0x07, 0x00, 0x1C, 0x07, 0x00, 0x1C, 0x07, 0x00, 0x1C, 0x07, 0x00, 0x1C, 0x07, 0x00, 0x1C, 0x07,
+    0x0E, 0x1C, 0x07, 0x0E, 0x1C, 0x07, 0x0E, 0x1C, 0x07, 0x0E, 0x1C, 0x07, 0x0E, 0x1C, 0x07, 0x0E,
+    0x1C, 0x07, 0x0E, 0x1C, 0x0F, 0x1F, 0x1E, 0x9F, 0x3F, 0x1F, 0xFF, 0xFF, 0x1F, 0xFE, 0xFF, 0x0F,
+    0xFE, 0xFF, 0x0F, 0xFC, 0xF1, 0x07, 0xF8, 0xF1, 0x03, 0x60, 0xC0, 0x00, 0xE0, 0x1F, 0x00, 0xF0,
+    0x3F, 0x00, 0xF8, 0x7F, 0x00, 0xF8, 0x7F, 0x00, 0xF0, 0x7F, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0x7C,
+    0x00, 0x00, 0x78, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xFC, 0x01,
+    0xFC, 0xFF, 0x07, 0xFE, 0xFF, 0x0F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x1F, 0xFE, 0xFF, 0x0F, 0xFC,
+    0xFF, 0x07, 0x00, 0xFC, 0x01, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x7C, 0x80, 0x03, 0xFE, 0x80,
+    0x03, 0xFF, 0x81, 0x07, 0xFF, 0x81, 0x0F, 0xFF, 0x01, 0x0F, 0xFF, 0x01, 0x1F, 0xC7, 0x01, 0x1E,
+    0xC7, 0x01, 0x1E, 0xC7, 0x01, 0x1C, 0xC7, 0x01, 0x1C, 0xC7, 0x01, 0x1C, 0xC7, 0x01, 0x1C, 0xC7,
+    0x01, 0x1C, 0xC7, 0x03, 0x1E, 0xC7, 0x07, 0x1F, 0xC7, 0xFF, 0x1F, 0x87, 0xFF, 0x0F, 0x87, 0xFF,
+    0x0F, 0x07, 0xFF, 0x07, 0x07, 0xFE, 0x03, 0x07, 0xF8, 0x00, 0xE0, 0xFF, 0x00, 0xF8, 0xFF, 0x03,
+    0xFC, 0xFF, 0x07, 0xFE, 0xFF, 0x0F, 0xFE, 0xFF, 0x0F, 0xFF, 0xFF, 0x1F, 0x9F, 0x3F, 0x1F, 0x0F,
+    0x1F, 0x1E, 0x07, 0x0E, 0x1C, 0x07, 0x0E, 0x1C, 0x07, 0x0E, 0x1C, 0x07, 0x0E, 0x1C, 0x07, 0x0E,
+    0x1C, 0x07, 0x1E, 0x1E, 0x07, 0x3E, 0x1F, 0x07, 0xFE, 0x1F, 0x07, 0xFC, 0x0F, 0x07, 0xFC, 0x0F,
+    0x00, 0xF8, 0x07, 0x00, 0xF0, 0x03, 0x00, 0xC0, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x06, 0x07, 0x80,
+    0x0F, 0x07, 0xC0, 0x1F, 0x07, 0xE0, 0x1F, 0x07, 0xF0, 0x0F, 0x07, 0xF8, 0x07, 0x07, 0xFC, 0x01,
+    0x0F, 0x7E, 0x00, 0x9F, 0x3F, 0x00, 0xFF, 0x1F, 0x00, 0xFF, 0x0F, 0x00, 0xFF, 0x07, 0x00, 0xFF,
+    0x03, 0x00, 0xFE, 0x01, 0x00, 0x7C, 0x00, 0x00, 0x60, 0xC0, 0x00, 0xF8, 0xF1, 0x03, 0xFC, 0xF1,
+    0x07, 0xFE, 0xFF, 0x0F, 0xFE, 0xFF, 0x0F, 0xFF, 0xFF, 0x1F, 0x9F, 0x3F, 0x1F, 0x0F, 0x1F, 0x1E,
+    0x07, 0x0E, 0x1C, 0x07, 0x0E, 0x1C, 0x07, 0x0E, 0x1C, 0x07, 0x0E, 0x1C, 0x07, 0x0E, 0x1C, 0x0F,
+    0x1F, 0x1E, 0x9F, 0x3F, 0x1F, 0xFF, 0xFF, 0x1F, 0xFE, 0xFF, 0x0F, 0xFE, 0xFF, 0x0F, 0xFC, 0xF1,
+    0x07, 0xF8, 0xF1, 0x03, 0x60, 0xC0, 0x00, 0x60, 0x00, 0x00, 0xF8, 0x01, 0x00, 0xFC, 0x03, 0x00,
+    0xFE, 0x07, 0x1C, 0xFE, 0x07, 0x1C, 0xFF, 0x0F, 0x1C, 0x9F, 0x0F, 0x1C, 0x0F, 0x0F, 0x1C, 0x07,
+    0x0E, 0x1C, 0x07, 0x0E, 0x1C, 0x07, 0x0E, 0x1C, 0x07, 0x0E, 0x1C, 0x07, 0x0E, 0x1C, 0x0F, 0x1F,
+    0x1E, 0x9F, 0x3F, 0x1F, 0xFF, 0xFF, 0x1F, 0xFE, 0xFF, 0x0F, 0xFE, 0xFF, 0x0F, 0xFC, 0xFF, 0x07,
+    0xF8, 0xFF, 0x03, 0xE0, 0xFF, 0x00,
+};
+
+const font_t font_digits24 = {
+    .first = 0x20,
+    .last = 0x39,
+    .pages = 3,
+    .spacing = 3,
+    .widths = font_digits24_widths,
+    .offsets = font_digits24_offsets,
+    .data = font_digits24_data,
+};
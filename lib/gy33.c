@@ -1,6 +1,12 @@
 #include "gy33.h"
+#include "gy33_uart.h"
+#include "uart_dma.h"
+#include "color_lut.h"
+#include "reg_shadow.h"
+#include "device_presence.h"
 #include "hardware/i2c.h"
 #include <stdio.h>
+#include <string.h>
 
 // Definições do sensor GY-33
 #define GY33_I2C_ADDR 0x29
@@ -19,12 +25,62 @@
 #define GDATA_REG 0x98
 #define BDATA_REG 0x9A
 
+// Bits do registrador de comando e dos registradores ENABLE/STATUS
+#define CMD_AUTO_INC 0x20 // Tipo de transação: acesso com autoincremento
+#define CMD_BIT 0x80
+#define REG_ADDR_MASK 0x1F
+#define ENABLE_PON 0x01
+#define ENABLE_AEN 0x02
+#define STATUS_AVALID 0x01
+
+// --- Transporte UART (processador embarcado do módulo) ---
+#define GY33_UART_BAUD_INITIAL 9600
+#define GY33_UART_BAUD 115200
+#define GY33_UART_RING_BITS 8
+
+typedef enum
+{
+    GY33_TRANSPORT_I2C,
+    GY33_TRANSPORT_UART
+} gy33_transport_t;
+
+static gy33_transport_t transport = GY33_TRANSPORT_I2C;
+static uart_dma_rx_t uart_rx;
+static gy33_parser_t parser;
+UART_DMA_RING(uart_rx_ring, GY33_UART_RING_BITS);
+
+// Últimos valores recebidos por UART
+static uint16_t uart_rgbc[4]; // R, G, B, C
+static uint16_t uart_lux;
+static uint16_t uart_ct;
+
 // --- Calibração e Correção de Cor ---
 
 // Variáveis estáticas para armazenar as referências de calibração P/B
 static uint16_t white_ref[3]; // R, G, B
 static uint16_t black_ref[3]; // R, G, B
 
+// Correção por tabela 3D (color_lut) em vez da CCM
+static bool use_lut = false;
+
+// Ganho de compensação da luz ambiente sobre a cor calibrada
+static float ambient_gain = 1.0f;
+
+// Valor atual do registrador ATIME
+static uint8_t atime = GY33_ATIME_DEFAULT;
+
+// Sombra dos registradores de configuração (endereços 0x00-0x0F)
+#define GY33_SHADOW_REGS 0x10
+static uint8_t shadow_values[GY33_SHADOW_REGS];
+static reg_shadow_t shadow;
+
+// Sensor pode ser desconectado: sem ele as leituras falham sem ir ao barramento
+static dev_presence_t presence;
+
+// Reconectado e ainda sem integração completa: os registradores de dados
+// estão zerados e as leituras retornam "sem dados" até STATUS.AVALID
+static bool warming = false;
+
 // Matriz de Correção de Cor (CCM) calculada com os dados fornecidos
 static const float ccm[3][3] = {
     {1.81f, -0.10f, -0.48f},
@@ -32,10 +88,12 @@ static const float ccm[3][3] = {
     {-0.28f, -2.70f, 4.11f}};
 
 // Funções internas (estáticas)
+static bool gy33_shadow_write(reg_shadow_t *sh, uint8_t first, uint8_t count);
+static bool gy33_on_online(dev_presence_t *dev);
 static void gy33_write_register(uint8_t reg, uint8_t value);
-static uint16_t gy33_read_register(uint8_t reg);
-static void gy33_read_raw_rgb(uint16_t *r, uint16_t *g, uint16_t *b);
-static void gy33_get_bw_calibrated_rgb(uint8_t *r, uint8_t *g, uint8_t *b);
+static bool gy33_read_register(uint8_t reg, uint16_t *value);
+static bool gy33_read_raw_rgb(uint16_t *r, uint16_t *g, uint16_t *b);
+static bool gy33_warmed_up(void);
 
 // Implementação das funções públicas
 void gy33_init()
@@ -46,35 +104,148 @@ void gy33_init()
     gpio_pull_up(SDA_PIN);
     gpio_pull_up(SCL_PIN);
     printf("Iniciando GY-33...\n");
-    gy33_write_register(ENABLE_REG, 0x03);
-    gy33_write_register(ATIME_REG, 0xF5);
-    gy33_write_register(CONTROL_REG, 0x00);
+    if (!dev_presence_init(&presence, "GY-33", I2C_PORT, GY33_I2C_ADDR, gy33_on_online))
+        printf("GY-33 não encontrado: configuração aplicada quando for conectado\n");
+
+    // Ausente no boot: os registradores ficam sujos até a reconexão.
+    // ENABLE e ATIME são contíguos: uma transação; CONTROL vai em outra
+    reg_shadow_init(&shadow, "gy33", shadow_values, GY33_SHADOW_REGS, gy33_shadow_write, NULL);
+    reg_shadow_set(&shadow, ENABLE_REG & REG_ADDR_MASK, ENABLE_PON | ENABLE_AEN);
+    reg_shadow_set(&shadow, ATIME_REG & REG_ADDR_MASK, atime);
+    reg_shadow_set(&shadow, CONTROL_REG & REG_ADDR_MASK, 0x00);
+    reg_shadow_flush(&shadow);
 }
 
-void gy33_calibrate_white()
+static void gy33_uart_send_command(uint8_t cmd)
 {
-    gy33_read_raw_rgb(&white_ref[0], &white_ref[1], &white_ref[2]);
+    uint8_t frame[3];
+    gy33_build_command(cmd, frame);
+    uart_write_blocking(uart_rx.uart, frame, sizeof(frame));
+    uart_tx_wait_blocking(uart_rx.uart);
+}
+
+void gy33_init_uart(uart_inst_t *uart, uint tx_pin, uint rx_pin)
+{
+    uart_init(uart, GY33_UART_BAUD_INITIAL);
+    gpio_set_function(tx_pin, GPIO_FUNC_UART);
+    gpio_set_function(rx_pin, GPIO_FUNC_UART);
+    uart_rx.uart = uart;
+    printf("Iniciando GY-33 (UART)...\n");
+
+    // Sobe o baud do módulo: mais quadros por segundo e menos tempo de linha
+    gy33_uart_send_command(GY33_CMD_BAUD_115200);
+    sleep_ms(10);
+    uart_set_baudrate(uart, GY33_UART_BAUD);
+
+    gy33_parser_init(&parser);
+    uart_dma_rx_init(&uart_rx, uart, uart_rx_ring, GY33_UART_RING_BITS);
+
+    // Saída contínua de RGBC bruto e lux/CT: o DMA recebe, ninguém faz polling
+    gy33_uart_send_command(GY33_CMD_CONTINUOUS | GY33_OUT_RAW | GY33_OUT_LUX_CT);
+    transport = GY33_TRANSPORT_UART;
+}
+
+bool gy33_poll(void)
+{
+    if (transport != GY33_TRANSPORT_UART)
+        return false;
+
+    bool new_raw = false;
+    int byte;
+    while ((byte = uart_dma_rx_getc(&uart_rx)) >= 0)
+    {
+        if (!gy33_parser_feed(&parser, (uint8_t)byte))
+            continue;
+
+        const uint8_t *d = parser.data;
+        if (parser.type == GY33_FRAME_RAW && parser.len == 8)
+        {
+            for (int i = 0; i < 4; i++)
+                uart_rgbc[i] = (d[2 * i] << 8) | d[2 * i + 1];
+            new_raw = true;
+        }
+        else if (parser.type == GY33_FRAME_LUX_CT && parser.len == 4)
+        {
+            uart_lux = (d[0] << 8) | d[1];
+            uart_ct = (d[2] << 8) | d[3];
+        }
+    }
+    return new_raw;
+}
+
+bool gy33_get_lux_ct(uint16_t *lux, uint16_t *ct)
+{
+    if (transport != GY33_TRANSPORT_UART)
+        return false;
+    gy33_poll();
+    *lux = uart_lux;
+    *ct = uart_ct;
+    return true;
+}
+
+void gy33_update_clock(void)
+{
+    if (transport == GY33_TRANSPORT_UART)
+        uart_set_baudrate(uart_rx.uart, GY33_UART_BAUD);
+    else
+        i2c_set_baudrate(I2C_PORT, 100 * 1000);
+}
+
+bool gy33_calibrate_white()
+{
+    uint16_t ref[3];
+    if (!gy33_read_raw_rgb(&ref[0], &ref[1], &ref[2]))
+    {
+        printf("GY-33 ausente: referência BRANCO mantida\n");
+        return false;
+    }
+    memcpy(white_ref, ref, sizeof(ref));
     printf("Referência BRANCO salva: R=%d, G=%d, B=%d\n", white_ref[0], white_ref[1], white_ref[2]);
+    return true;
 }
 
-void gy33_calibrate_black()
+bool gy33_calibrate_black()
 {
-    gy33_read_raw_rgb(&black_ref[0], &black_ref[1], &black_ref[2]);
+    uint16_t ref[3];
+    if (!gy33_read_raw_rgb(&ref[0], &ref[1], &ref[2]))
+    {
+        printf("GY-33 ausente: referência PRETO mantida\n");
+        return false;
+    }
+    memcpy(black_ref, ref, sizeof(ref));
     printf("Referência PRETO salva: R=%d, G=%d, B=%d\n", black_ref[0], black_ref[1], black_ref[2]);
+    return true;
+}
+
+bool gy33_get_final_rgb(uint8_t *r_final, uint8_t *g_final, uint8_t *b_final)
+{
+    uint16_t r_raw, g_raw, b_raw;
+    if (!gy33_read_raw_rgb(&r_raw, &g_raw, &b_raw))
+        return false;
+    gy33_correct_rgb(r_raw, g_raw, b_raw, r_final, g_final, b_final);
+    return true;
 }
 
-void gy33_get_final_rgb(uint8_t *r_final, uint8_t *g_final, uint8_t *b_final)
+void gy33_correct_rgb(uint16_t r_raw, uint16_t g_raw, uint16_t b_raw,
+                      uint8_t *r_final, uint8_t *g_final, uint8_t *b_final)
 {
     uint8_t r_bw, g_bw, b_bw;
     // 1. Obter cor calibrada por P/B
-    gy33_get_bw_calibrated_rgb(&r_bw, &g_bw, &b_bw);
+    gy33_normalize_rgb(r_raw, g_raw, b_raw, &r_bw, &g_bw, &b_bw);
+
+    // 2. Tabela 3D (inteira) no lugar da matriz, se habilitada
+    if (use_lut)
+    {
+        color_lut_apply(r_bw, g_bw, b_bw, r_final, g_final, b_final);
+        return;
+    }
 
-    // 2. Aplicar a Matriz de Correção de Cor
+    // 3. Aplicar a Matriz de Correção de Cor
     float r_corrected = ccm[0][0] * r_bw + ccm[0][1] * g_bw + ccm[0][2] * b_bw;
     float g_corrected = ccm[1][0] * r_bw + ccm[1][1] * g_bw + ccm[1][2] * b_bw;
     float b_corrected = ccm[2][0] * r_bw + ccm[2][1] * g_bw + ccm[2][2] * b_bw;
 
-    // 3. Limitar os valores ao intervalo 0-255
+    // 4. Limitar os valores ao intervalo 0-255
     if (r_corrected > 255.0f)
         r_corrected = 255.0f;
     else if (r_corrected < 0)
@@ -93,12 +264,95 @@ void gy33_get_final_rgb(uint8_t *r_final, uint8_t *g_final, uint8_t *b_final)
     *b_final = (uint8_t)b_corrected;
 }
 
-// Implementação das funções internas
-static void gy33_get_bw_calibrated_rgb(uint8_t *r_cal, uint8_t *g_cal, uint8_t *b_cal)
+void gy33_start_integration(void)
 {
-    uint16_t r_raw, g_raw, b_raw;
-    gy33_read_raw_rgb(&r_raw, &g_raw, &b_raw);
+    // PON + AEN: com o ADC parado, um novo ciclo de integração começa agora
+    gy33_write_register(ENABLE_REG, ENABLE_PON | ENABLE_AEN);
+}
+
+void gy33_stop_integration(void)
+{
+    gy33_write_register(ENABLE_REG, ENABLE_PON);
+}
+
+bool gy33_data_ready(void)
+{
+    uint16_t status;
+    return gy33_read_register(STATUS_REG, &status) && (status & STATUS_AVALID);
+}
+
+bool gy33_read_raw_crgb(uint16_t *c, uint16_t *r, uint16_t *g, uint16_t *b)
+{
+    if (transport == GY33_TRANSPORT_UART)
+    {
+        gy33_poll();
+        *c = uart_rgbc[3];
+        *r = uart_rgbc[0];
+        *g = uart_rgbc[1];
+        *b = uart_rgbc[2];
+        return true;
+    }
+
+    // Leitura em rajada: CDATA..BDATAH (8 bytes) numa única transação
+    uint8_t reg = CDATA_REG | CMD_AUTO_INC;
+    uint8_t buffer[8];
+    if (!dev_presence_write(&presence, &reg, 1, true) || !dev_presence_read(&presence, buffer, 8, false) ||
+        !gy33_warmed_up())
+        return false;
+    *c = (buffer[1] << 8) | buffer[0];
+    *r = (buffer[3] << 8) | buffer[2];
+    *g = (buffer[5] << 8) | buffer[4];
+    *b = (buffer[7] << 8) | buffer[6];
+    return true;
+}
+
+void gy33_set_atime(uint8_t value)
+{
+    atime = value;
+    if (transport == GY33_TRANSPORT_I2C)
+        gy33_write_register(ATIME_REG, value);
+}
+
+void gy33_use_lut(bool enable)
+{
+    use_lut = enable;
+}
+
+void gy33_set_ambient_gain(float gain)
+{
+    ambient_gain = gain;
+}
+
+uint8_t gy33_get_atime(void)
+{
+    return atime;
+}
 
+const reg_shadow_t *gy33_get_shadow(void)
+{
+    return &shadow;
+}
+
+bool gy33_is_present(void)
+{
+    // O processador do módulo não tem probe: na UART vale o último quadro
+    return transport == GY33_TRANSPORT_UART || dev_presence_online(&presence);
+}
+
+const dev_presence_t *gy33_get_presence(void)
+{
+    return &presence;
+}
+
+uint32_t gy33_integration_time_us(void)
+{
+    // Cada ciclo do ADC dura 2.4 ms; ATIME = 256 - ciclos
+    return (256 - atime) * 2400;
+}
+
+void gy33_normalize_rgb(uint16_t r_raw, uint16_t g_raw, uint16_t b_raw,
+                        uint8_t *r_cal, uint8_t *g_cal, uint8_t *b_cal)
+{
     uint16_t raw_values[] = {r_raw, g_raw, b_raw};
     uint8_t *cal_values[] = {r_cal, g_cal, b_cal};
 
@@ -112,7 +366,7 @@ static void gy33_get_bw_calibrated_rgb(uint8_t *r_cal, uint8_t *g_cal, uint8_t *
         }
         else
         {
-            calibrated_float = ((float)raw_values[i] - (float)black_ref[i]) / range * 255.0f;
+            calibrated_float = ((float)raw_values[i] - (float)black_ref[i]) / range * 255.0f * ambient_gain;
         }
         if (calibrated_float > 255.0f)
             calibrated_float = 255.0f;
@@ -122,23 +376,61 @@ static void gy33_get_bw_calibrated_rgb(uint8_t *r_cal, uint8_t *g_cal, uint8_t *
     }
 }
 
+// Implementação das funções internas
+static bool gy33_shadow_write(reg_shadow_t *sh, uint8_t first, uint8_t count)
+{
+    uint8_t buffer[1 + GY33_SHADOW_REGS];
+    buffer[0] = CMD_BIT | (count > 1 ? CMD_AUTO_INC : 0) | first;
+    memcpy(&buffer[1], &sh->values[first], count);
+    return dev_presence_write(&presence, buffer, count + 1, false);
+}
+
+// Reconectado (ou conectado depois do boot): o sensor voltou aos valores de
+// reset, então a sombra inteira é reenviada
+static bool gy33_on_online(dev_presence_t *dev)
+{
+    (void)dev;
+    warming = true;
+    reg_shadow_invalidate(&shadow);
+    return reg_shadow_flush(&shadow) >= 0;
+}
+
+// A reconexão acontece dentro da própria leitura que a detectou: o
+// resultado só vale depois que o sensor completa a primeira integração
+static bool gy33_warmed_up(void)
+{
+    if (warming && gy33_data_ready())
+        warming = false;
+    return !warming;
+}
+
+// Escrita imediata, filtrada pela sombra: valor repetido não vai ao barramento
 static void gy33_write_register(uint8_t reg, uint8_t value)
 {
-    uint8_t buffer[2] = {reg, value};
-    i2c_write_blocking(I2C_PORT, GY33_I2C_ADDR, buffer, 2, false);
+    reg_shadow_set(&shadow, reg & REG_ADDR_MASK, value);
+    reg_shadow_flush(&shadow);
 }
 
-static uint16_t gy33_read_register(uint8_t reg)
+static bool gy33_read_register(uint8_t reg, uint16_t *value)
 {
     uint8_t buffer[2];
-    i2c_write_blocking(I2C_PORT, GY33_I2C_ADDR, &reg, 1, true);
-    i2c_read_blocking(I2C_PORT, GY33_I2C_ADDR, buffer, 2, false);
-    return (buffer[1] << 8) | buffer[0];
+    if (!dev_presence_write(&presence, &reg, 1, true) || !dev_presence_read(&presence, buffer, 2, false))
+        return false;
+    *value = (buffer[1] << 8) | buffer[0];
+    return true;
 }
 
-static void gy33_read_raw_rgb(uint16_t *r, uint16_t *g, uint16_t *b)
+static bool gy33_read_raw_rgb(uint16_t *r, uint16_t *g, uint16_t *b)
 {
-    *r = gy33_read_register(RDATA_REG);
-    *g = gy33_read_register(GDATA_REG);
-    *b = gy33_read_register(BDATA_REG);
+    if (transport == GY33_TRANSPORT_UART)
+    {
+        // Sem tráfego no barramento: usa o último quadro recebido por DMA
+        gy33_poll();
+        *r = uart_rgbc[0];
+        *g = uart_rgbc[1];
+        *b = uart_rgbc[2];
+        return true;
+    }
+    return gy33_read_register(RDATA_REG, r) && gy33_read_register(GDATA_REG, g) &&
+           gy33_read_register(BDATA_REG, b) && gy33_warmed_up();
 }
@@ -2,21 +2,64 @@
 #define GY33_H
 
 #include "pico/stdlib.h"
+#include "hardware/uart.h"
+#include "reg_shadow.h"
+#include "device_presence.h"
+
+// Integration time register values (ATIME = 256 - cycles of 2.4 ms)
+#define GY33_ATIME_DEFAULT 0xF5 // 11 cycles = 26.4 ms
+#define GY33_ATIME_MIN 0xFF     // 1 cycle = 2.4 ms, fastest sampling
 
 /**
  * @brief Initializes the I2C communication and the GY-33 sensor.
  */
 void gy33_init(void);
 
+/**
+ * @brief Initializes the GY-33 through its onboard processor's UART output.
+ *
+ * The module is switched to 115200 baud and continuous raw RGBC + lux/CT output.
+ * Frames are received by DMA into a ring buffer and parsed incrementally, so the
+ * remaining API works unchanged without any bus polling.
+ *
+ * @param uart UART instance wired to the module.
+ * @param tx_pin GPIO used as UART TX (to module RX).
+ * @param rx_pin GPIO used as UART RX (from module TX).
+ */
+void gy33_init_uart(uart_inst_t *uart, uint tx_pin, uint rx_pin);
+
+/**
+ * @brief Parses every frame received since the last call (UART transport only).
+ *
+ * @return true if a new raw RGBC frame arrived.
+ */
+bool gy33_poll(void);
+
+/**
+ * @brief Latest lux and colour temperature computed by the module (UART transport only).
+ *
+ * @return false when the I2C transport is in use.
+ */
+bool gy33_get_lux_ct(uint16_t *lux, uint16_t *ct);
+
+/**
+ * @brief Re-derives the bus baud rate after a system clock change.
+ */
+void gy33_update_clock(void);
+
 /**
  * @brief Reads the current sensor values and stores them as the white reference.
+ *
+ * @return false if the sensor is missing; the previous reference is kept.
  */
-void gy33_calibrate_white(void);
+bool gy33_calibrate_white(void);
 
 /**
  * @brief Reads the current sensor values and stores them as the black reference.
+ *
+ * @return false if the sensor is missing; the previous reference is kept.
  */
-void gy33_calibrate_black(void);
+bool gy33_calibrate_black(void);
 
 /**
  * @brief Applies black/white calibration and a color correction matrix to get the final, corrected RGB values.
@@ -24,7 +67,101 @@ void gy33_calibrate_black(void);
  * @param r Pointer to store the final red value (0-255).
  * @param g Pointer to store the final green value (0-255).
  * @param b Pointer to store the final blue value (0-255).
+ * @return false if the sensor is missing (outputs untouched).
+ */
+bool gy33_get_final_rgb(uint8_t *r, uint8_t *g, uint8_t *b);
+
+/**
+ * @brief Applies black/white calibration and the colour correction matrix to raw readings.
+ *
+ * Same processing as gy33_get_final_rgb, for raw values obtained elsewhere
+ * (burst reads, triggered captures).
+ */
+void gy33_correct_rgb(uint16_t r_raw, uint16_t g_raw, uint16_t b_raw,
+                      uint8_t *r, uint8_t *g, uint8_t *b);
+
+/**
+ * @brief Normalizes raw readings against the black/white references (0-255 per channel).
+ *
+ * This is the input of the colour correction stage (CCM or 3D LUT), and the
+ * space in which tools/build_lut.py expects measurements.
+ */
+void gy33_normalize_rgb(uint16_t r_raw, uint16_t g_raw, uint16_t b_raw,
+                        uint8_t *r, uint8_t *g, uint8_t *b);
+
+/**
+ * @brief Selects the 3D LUT (color_lut) instead of the 3x3 CCM for colour correction.
+ */
+void gy33_use_lut(bool enable);
+
+/**
+ * @brief Sets the ambient compensation gain applied to the black/white calibrated values.
+ *
+ * 1.0 reproduces the illumination captured at white calibration.
+ */
+void gy33_set_ambient_gain(float gain);
+
+/**
+ * @brief Starts a new integration cycle (ENABLE = PON | AEN).
+ *
+ * When the ADC was stopped with gy33_stop_integration, integration begins immediately.
+ */
+void gy33_start_integration(void);
+
+/**
+ * @brief Stops the RGBC ADC, keeping the oscillator powered (ENABLE = PON).
+ */
+void gy33_stop_integration(void);
+
+/**
+ * @brief Returns true when a completed integration is available (STATUS.AVALID).
+ *
+ * Always false while the sensor is missing.
+ */
+bool gy33_data_ready(void);
+
+/**
+ * @brief Reads clear, red, green and blue counts in a single burst transaction.
+ *
+ * @return false if the sensor is missing or the transfer failed (no data).
+ */
+bool gy33_read_raw_crgb(uint16_t *c, uint16_t *r, uint16_t *g, uint16_t *b);
+
+/**
+ * @brief Sets the integration time register (ATIME = 256 - cycles of 2.4 ms).
+ *
+ * Only reaches the sensor on the I2C transport; the module's own MCU
+ * manages integration when the UART transport is active.
+ */
+void gy33_set_atime(uint8_t atime);
+
+/**
+ * @brief Returns the current integration time register value.
+ */
+uint8_t gy33_get_atime(void);
+
+/**
+ * @brief Shadow of the configuration registers (ENABLE, ATIME, CONTROL).
+ *
+ * Writes that would not change the sensor are dropped; its counters show
+ * how many bus transactions that saved.
+ */
+const reg_shadow_t *gy33_get_shadow(void);
+
+/**
+ * @brief true while the sensor answers on the bus (always true on the UART transport).
+ *
+ * A missing sensor costs no bus time: transactions fail immediately and an
+ * address probe is retried with exponential backoff (lib/device_presence).
+ * On reconnection the configuration registers are written again.
+ */
+bool gy33_is_present(void);
+
+const dev_presence_t *gy33_get_presence(void);
+
+/**
+ * @brief Duration of one integration cycle with the current ATIME, in microseconds.
  */
-void gy33_get_final_rgb(uint8_t *r, uint8_t *g, uint8_t *b);
+uint32_t gy33_integration_time_us(void);
 
 #endif // GY33_H
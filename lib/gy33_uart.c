@@ -0,0 +1,74 @@
+#include "gy33_uart.h"
+
+void gy33_parser_init(gy33_parser_t *parser)
+{
+    parser->state = GY33_PARSE_SYNC1;
+    parser->frames_ok = 0;
+    parser->checksum_errors = 0;
+}
+
+bool gy33_parser_feed(gy33_parser_t *parser, uint8_t byte)
+{
+    switch (parser->state)
+    {
+    case GY33_PARSE_SYNC1:
+        if (byte == GY33_FRAME_HEADER)
+        {
+            parser->sum = byte;
+            parser->state = GY33_PARSE_SYNC2;
+        }
+        break;
+    case GY33_PARSE_SYNC2:
+        if (byte == GY33_FRAME_HEADER)
+        {
+            parser->sum += byte;
+            parser->state = GY33_PARSE_TYPE;
+        }
+        else
+        {
+            parser->state = GY33_PARSE_SYNC1;
+        }
+        break;
+    case GY33_PARSE_TYPE:
+        if (byte == GY33_FRAME_HEADER)
+            break; // 0x5A 0x5A 0x5A: ainda sincronizando
+        parser->type = byte;
+        parser->sum += byte;
+        parser->state = GY33_PARSE_LEN;
+        break;
+    case GY33_PARSE_LEN:
+        if (byte == 0 || byte > GY33_FRAME_MAX_DATA)
+        {
+            parser->state = GY33_PARSE_SYNC1; // Tamanho impossível: ressincroniza
+            break;
+        }
+        parser->len = byte;
+        parser->index = 0;
+        parser->sum += byte;
+        parser->state = GY33_PARSE_DATA;
+        break;
+    case GY33_PARSE_DATA:
+        parser->data[parser->index++] = byte;
+        parser->sum += byte;
+        if (parser->index == parser->len)
+            parser->state = GY33_PARSE_SUM;
+        break;
+    case GY33_PARSE_SUM:
+        parser->state = GY33_PARSE_SYNC1;
+        if (byte == parser->sum)
+        {
+            parser->frames_ok++;
+            return true;
+        }
+        parser->checksum_errors++;
+        break;
+    }
+    return false;
+}
+
+void gy33_build_command(uint8_t cmd, uint8_t out[3])
+{
+    out[0] = GY33_CMD_HEADER;
+    out[1] = cmd;
+    out[2] = (uint8_t)(GY33_CMD_HEADER + cmd);
+}
@@ -0,0 +1,64 @@
+#ifndef GY33_UART_H
+#define GY33_UART_H
+
+#include "pico/stdlib.h"
+
+// --- Protocolo serial do processador do GY-33 ---
+// Quadro: 0x5A 0x5A <tipo> <tamanho> <dados...> <soma>, soma = 8 bits da soma dos bytes anteriores
+#define GY33_FRAME_HEADER 0x5A
+#define GY33_FRAME_RAW 0x15     // R, G, B, C brutos (16 bits, MSB primeiro)
+#define GY33_FRAME_LUX_CT 0x25  // Lux e temperatura de cor (16 bits cada)
+#define GY33_FRAME_RGB 0x45     // R, G, B processados (8 bits)
+#define GY33_FRAME_MAX_DATA 8
+
+// Comando: 0xA5 <cmd> <soma>
+#define GY33_CMD_HEADER 0xA5
+#define GY33_CMD_CONTINUOUS 0x50 // OR com GY33_OUT_*: saída contínua
+#define GY33_CMD_QUERY 0x80      // OR com GY33_OUT_*: uma leitura
+#define GY33_OUT_RAW 0x01
+#define GY33_OUT_LUX_CT 0x02
+#define GY33_OUT_RGB 0x04
+#define GY33_CMD_BAUD_9600 0xAE
+#define GY33_CMD_BAUD_115200 0xAF
+
+typedef enum
+{
+    GY33_PARSE_SYNC1,
+    GY33_PARSE_SYNC2,
+    GY33_PARSE_TYPE,
+    GY33_PARSE_LEN,
+    GY33_PARSE_DATA,
+    GY33_PARSE_SUM
+} gy33_parse_state_t;
+
+/**
+ * @brief Parser incremental de quadros: recebe um byte por vez, sem buffer de linha.
+ */
+typedef struct
+{
+    gy33_parse_state_t state;
+    uint8_t type;
+    uint8_t len;
+    uint8_t index;
+    uint8_t sum;
+    uint8_t data[GY33_FRAME_MAX_DATA];
+    uint32_t frames_ok;
+    uint32_t checksum_errors;
+} gy33_parser_t;
+
+void gy33_parser_init(gy33_parser_t *parser);
+
+/**
+ * @brief Alimenta o parser com um byte.
+ *
+ * @return true quando um quadro completo e com soma válida está em
+ * parser->type / parser->data (válido até o próximo byte).
+ */
+bool gy33_parser_feed(gy33_parser_t *parser, uint8_t byte);
+
+/**
+ * @brief Monta um comando de 3 bytes com a soma de verificação.
+ */
+void gy33_build_command(uint8_t cmd, uint8_t out[3]);
+
+#endif // GY33_UART_H
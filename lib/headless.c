@@ -0,0 +1,207 @@
+#include <stdio.h>
+#include "headless.h"
+#include "gy33.h"
+#include "tusb.h"
+#if LIB_PICO_STDIO_UART
+#include "pico/stdio_uart.h"
+#endif
+
+// Linha por amostra: "4294967295,65535,65535,65535,65535\n"
+#define HEADLESS_LINE_MAX 36
+// Resumo periódico embutido no fluxo (linhas começando com '#')
+#define HEADLESS_REPORT_US 1000000
+
+typedef struct
+{
+    uint32_t t_us;
+    uint16_t c, r, g, b;
+} headless_sample_t;
+
+static headless_sample_t batch[HEADLESS_BATCH];
+static uint8_t batch_count;
+
+// Texto do último lote, drenado aos poucos conforme a USB aceita
+static char out[HEADLESS_BATCH * HEADLESS_LINE_MAX + 96];
+static uint16_t out_len;
+static uint16_t out_pos;
+
+static headless_stats_t stats;
+static uint64_t integration_start_us;
+static uint64_t last_sample_us;
+static uint64_t last_report_us;
+static uint32_t last_report_samples;
+static uint8_t saved_atime;
+
+// Reinicia a integração: a próxima leitura é sempre uma amostra nova
+static void headless_restart_integration(void)
+{
+    gy33_stop_integration();
+    gy33_start_integration();
+    integration_start_us = time_us_64();
+}
+
+// Converte o lote em texto; o buffer de saída precisa estar vazio
+static void headless_render_batch(void)
+{
+    uint16_t len = 0;
+    for (uint8_t i = 0; i < batch_count; i++)
+    {
+        const headless_sample_t *s = &batch[i];
+        len += snprintf(out + len, sizeof(out) - len, "%lu,%u,%u,%u,%u\n",
+                        s->t_us, s->c, s->r, s->g, s->b);
+    }
+
+    uint64_t now = time_us_64();
+    if (now - last_report_us >= HEADLESS_REPORT_US)
+    {
+        uint32_t rate = (uint64_t)(stats.samples - last_report_samples) * 1000000 / (now - last_report_us);
+        len += snprintf(out + len, sizeof(out) - len, "# %lu amostras/s, %lu perdidas, intervalo %lu-%lu us\n",
+                        rate, stats.dropped, stats.interval_min_us, stats.interval_max_us);
+        last_report_us = now;
+        last_report_samples = stats.samples;
+    }
+
+    out_len = len;
+    out_pos = 0;
+    batch_count = 0;
+}
+
+// Envia só o que cabe no FIFO da CDC: stdio nunca bloqueia a aquisição.
+// O driver de stdio da UART fica desligado no modo (headless_start): a
+// 115200 baud ele bloquearia cada envio e limitaria a vazão à da UART.
+static void headless_drain(void)
+{
+    if (out_pos >= out_len)
+        return;
+    if (!stdio_usb_connected())
+    {
+        out_pos = out_len; // Sem host: nada a entregar
+        return;
+    }
+
+    uint32_t room = tud_cdc_write_available();
+    uint32_t chunk = out_len - out_pos;
+    if (chunk > room)
+        chunk = room;
+    if (chunk == 0)
+        return;
+    stdio_put_string(out + out_pos, chunk, false, false);
+    out_pos += chunk;
+}
+
+static void headless_push(const headless_sample_t *sample)
+{
+    batch[batch_count++] = *sample;
+    if (batch_count < HEADLESS_BATCH)
+        return;
+
+    if (out_pos < out_len)
+    {
+        // O lote anterior ainda não saiu: este é perdido
+        stats.dropped += batch_count;
+        batch_count = 0;
+        return;
+    }
+    headless_render_batch();
+}
+
+void headless_start(void)
+{
+    saved_atime = gy33_get_atime();
+    gy33_set_atime(GY33_ATIME_MIN);
+
+    stats = (headless_stats_t){
+        .interval_min_us = UINT32_MAX,
+        .start_us = time_us_64(),
+    };
+    batch_count = 0;
+    out_len = out_pos = 0;
+    last_sample_us = 0;
+    last_report_us = stats.start_us;
+    last_report_samples = 0;
+
+    printf("# headless: t_us,c,r,g,b (integracao %lu us)\n", gy33_integration_time_us());
+#if LIB_PICO_STDIO_UART
+    // Fluxo só pela USB; a UART volta em headless_stop
+    stdio_flush();
+    stdio_set_driver_enabled(&stdio_uart, false);
+#endif
+    headless_restart_integration();
+}
+
+void headless_stop(void)
+{
+    batch_count = 0;
+    out_len = out_pos = 0;
+    gy33_set_atime(saved_atime);
+    gy33_start_integration();
+#if LIB_PICO_STDIO_UART
+    stdio_set_driver_enabled(&stdio_uart, true);
+#endif
+    headless_report();
+}
+
+void headless_poll(void)
+{
+    headless_drain();
+
+    uint64_t now = time_us_64();
+    if (now < integration_start_us + gy33_integration_time_us())
+        return;
+    if (!gy33_data_ready())
+    {
+        // Sensor ausente: próxima verificação uma integração depois, sem girar o loop
+        if (!gy33_is_present())
+            integration_start_us = now;
+        return;
+    }
+
+    headless_sample_t sample;
+    bool ok = gy33_read_raw_crgb(&sample.c, &sample.r, &sample.g, &sample.b);
+    uint64_t t = time_us_64();
+    headless_restart_integration();
+    if (!ok)
+        return;
+    sample.t_us = (uint32_t)t;
+
+    if (last_sample_us)
+    {
+        uint32_t interval = (uint32_t)(t - last_sample_us);
+        if (interval < stats.interval_min_us)
+            stats.interval_min_us = interval;
+        if (interval > stats.interval_max_us)
+            stats.interval_max_us = interval;
+        stats.interval_sum_us += interval;
+    }
+    last_sample_us = t;
+    stats.samples++;
+
+    headless_push(&sample);
+}
+
+absolute_time_t headless_next_due(void)
+{
+    return from_us_since_boot(integration_start_us + gy33_integration_time_us());
+}
+
+const headless_stats_t *headless_get_stats(void)
+{
+    return &stats;
+}
+
+void headless_report(void)
+{
+    uint64_t elapsed = time_us_64() - stats.start_us;
+    if (stats.samples < 2 || elapsed == 0)
+    {
+        printf("Headless: %lu amostras\n", stats.samples);
+        return;
+    }
+    uint32_t rate = (uint64_t)stats.samples * 1000000 / elapsed;
+    uint32_t mean = stats.interval_sum_us / (stats.samples - 1);
+    printf("Headless: %lu amostras em %llu ms (%lu amostras/s), %lu perdidas\n",
+           stats.samples, elapsed / 1000, rate, stats.dropped);
+    printf("  intervalo min %lu us  media %lu us  max %lu us  jitter %lu us\n",
+           stats.interval_min_us, mean, stats.interval_max_us,
+           stats.interval_max_us - stats.interval_min_us);
+}
@@ -0,0 +1,62 @@
+#ifndef HEADLESS_H
+#define HEADLESS_H
+
+#include "pico/stdlib.h"
+
+/**
+ * @brief Aquisição de vazão máxima para ensaios de caracterização.
+ *
+ * O GY-33 roda com ATIME mínimo (2.4 ms) e cada amostra é lida em rajada
+ * (C, R, G, B numa só transação). As amostras são acumuladas em lotes de
+ * HEADLESS_BATCH e enviadas pela USB como texto
+ * "t_us,c,r,g,b" sem bloquear a aquisição. Um lote que chega com o
+ * anterior ainda em trânsito é descartado e contado como perdido.
+ *
+ * Para cada amostra a integração é reiniciada, garantindo que nenhum
+ * valor é lido duas vezes. Requer o GY-33 em I2C.
+ */
+
+#define HEADLESS_BATCH 32
+
+typedef struct
+{
+    uint32_t samples;
+    uint32_t dropped;        // Amostras descartadas por falta de vazão na USB
+    uint32_t interval_min_us;
+    uint32_t interval_max_us;
+    uint64_t interval_sum_us;
+    uint64_t start_us;
+} headless_stats_t;
+
+/**
+ * @brief Entra no modo: ATIME mínimo, estatísticas zeradas, primeira integração.
+ *
+ * O stdio da UART é desligado até headless_stop: o fluxo sai só pela USB.
+ */
+void headless_start(void);
+
+/**
+ * @brief Sai do modo: descarta o lote parcial, restaura o ATIME e imprime o resumo.
+ */
+void headless_stop(void);
+
+/**
+ * @brief Lê a amostra pronta (se houver) e drena a saída pendente para a USB.
+ *
+ * Não bloqueia; deve ser chamado com frequência pelo loop principal.
+ */
+void headless_poll(void);
+
+/**
+ * @brief Instante em que a próxima amostra fica pronta.
+ */
+absolute_time_t headless_next_due(void);
+
+const headless_stats_t *headless_get_stats(void);
+
+/**
+ * @brief Imprime amostras/s, perdas e jitter do intervalo entre amostras.
+ */
+void headless_report(void);
+
+#endif // HEADLESS_H
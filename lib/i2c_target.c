@@ -0,0 +1,172 @@
+#include <stdio.h>
+#include "i2c_target.h"
+#include "pico/i2c_slave.h"
+#include "hardware/sync.h"
+#include "hardware/irq.h"
+
+#define NO_BUFFER 0xFF
+
+static uint8_t snapshot[2][REG_SNAPSHOT_END];
+static volatile uint8_t front = 0;          // Buffer servido às novas leituras
+static volatile uint8_t reading = NO_BUFFER; // Buffer fixado pela leitura em andamento
+static uint8_t config[REG_CFG_END - REG_CFG_ATIME];
+static volatile uint32_t written = 0;
+
+static uint32_t seq = 0;
+static i2c_target_stats_t stats;
+
+// Estado da transação atual (só a interrupção mexe)
+static struct
+{
+    uint8_t addr;
+    bool addr_written; // Primeiro byte recebido já foi o endereço
+    bool data_written;
+} xfer;
+
+static uint8_t reg_read(uint8_t buf, uint8_t addr)
+{
+    if (addr < REG_SNAPSHOT_END)
+        return snapshot[buf][addr];
+    if (addr >= REG_CFG_ATIME && addr < REG_CFG_END)
+        return config[addr - REG_CFG_ATIME];
+    return 0x00;
+}
+
+static void i2c_target_handler(i2c_inst_t *i2c, i2c_slave_event_t event)
+{
+    switch (event)
+    {
+    case I2C_SLAVE_RECEIVE:
+    {
+        uint8_t byte = i2c_read_byte_raw(i2c);
+        if (!xfer.addr_written)
+        {
+            xfer.addr = byte;
+            xfer.addr_written = true;
+            break;
+        }
+        // Só a área de configuração aceita escrita; o resto é ignorado
+        if (xfer.addr >= REG_CFG_ATIME && xfer.addr < REG_CFG_END)
+        {
+            config[xfer.addr - REG_CFG_ATIME] = byte;
+            written |= I2C_TARGET_CFG_BIT(xfer.addr);
+            xfer.data_written = true;
+        }
+        xfer.addr++;
+        break;
+    }
+    case I2C_SLAVE_REQUEST:
+        if (reading == NO_BUFFER)
+        {
+            // Primeiro byte da leitura: fixa o instantâneo até o STOP
+            reading = front;
+            stats.reads++;
+        }
+        i2c_write_byte_raw(i2c, reg_read(reading, xfer.addr++));
+        break;
+    case I2C_SLAVE_FINISH:
+        if (xfer.data_written)
+            stats.writes++;
+        xfer.addr_written = false;
+        xfer.data_written = false;
+        reading = NO_BUFFER;
+        break;
+    }
+}
+
+static void put_u16(uint8_t *buf, uint8_t addr, uint16_t v)
+{
+    buf[addr] = v & 0xFF;
+    buf[addr + 1] = v >> 8;
+}
+
+static void put_u32(uint8_t *buf, uint8_t addr, uint32_t v)
+{
+    put_u16(buf, addr, v & 0xFFFF);
+    put_u16(buf, addr + 2, v >> 16);
+}
+
+void i2c_target_init(i2c_inst_t *i2c, uint sda, uint scl, uint8_t address, uint baudrate)
+{
+    for (int b = 0; b < 2; b++)
+    {
+        snapshot[b][REG_WHO_AM_I] = I2C_TARGET_WHO_AM_I;
+        snapshot[b][REG_VERSION] = I2C_TARGET_VERSION;
+    }
+
+    gpio_set_function(sda, GPIO_FUNC_I2C);
+    gpio_set_function(scl, GPIO_FUNC_I2C);
+    gpio_pull_up(sda);
+    gpio_pull_up(scl);
+
+    // O baud define os tempos de hold do SDA também no modo alvo
+    i2c_init(i2c, baudrate);
+    i2c_slave_init(i2c, address, i2c_target_handler);
+
+    // A leitura dos sensores na IRQ do timer leva milissegundos no i2c0;
+    // acima dela, o alvo não segura o SCL do controlador durante esse tempo
+    irq_set_priority(I2C0_IRQ + i2c_hw_index(i2c), PICO_HIGHEST_IRQ_PRIORITY);
+}
+
+bool i2c_target_publish(const i2c_target_reading_t *rd)
+{
+    // A interrupção roda no mesmo núcleo: entre esta checagem e a troca ela
+    // só pode fixar o buffer da frente, nunca o de trás
+    uint8_t back = front ^ 1;
+    if (reading == back)
+    {
+        stats.deferred++;
+        return false;
+    }
+
+    uint8_t *buf = snapshot[back];
+    buf[REG_STATUS] = rd->status;
+    buf[REG_ALERTS] = rd->alerts;
+    put_u32(buf, REG_SEQ, ++seq);
+    put_u32(buf, REG_T_MS, rd->t_ms);
+    buf[REG_RGB] = rd->r;
+    buf[REG_RGB + 1] = rd->g;
+    buf[REG_RGB + 2] = rd->b;
+    put_u16(buf, REG_LUX, rd->lux);
+    put_u16(buf, REG_RAW_C, rd->raw_c);
+    put_u16(buf, REG_RAW_R, rd->raw_r);
+    put_u16(buf, REG_RAW_G, rd->raw_g);
+    put_u16(buf, REG_RAW_B, rd->raw_b);
+
+    front = back;
+    stats.published++;
+    return true;
+}
+
+uint32_t i2c_target_take_writes(void)
+{
+    uint32_t irq = save_and_disable_interrupts();
+    uint32_t mask = written;
+    written = 0;
+    restore_interrupts(irq);
+    return mask;
+}
+
+uint8_t i2c_target_get_reg(uint8_t reg)
+{
+    if (reg >= REG_CFG_ATIME && reg < REG_CFG_END)
+        return config[reg - REG_CFG_ATIME];
+    return reg < REG_SNAPSHOT_END ? snapshot[front][reg] : 0x00;
+}
+
+void i2c_target_set_reg(uint8_t reg, uint8_t value)
+{
+    if (reg >= REG_CFG_ATIME && reg < REG_CFG_END)
+        config[reg - REG_CFG_ATIME] = value;
+}
+
+const i2c_target_stats_t *i2c_target_get_stats(void)
+{
+    return &stats;
+}
+
+void i2c_target_report(void)
+{
+    printf("Alvo I2C: %lu leituras, %lu escritas, %lu publicados, %lu adiados\n",
+           stats.reads, stats.writes, stats.published, stats.deferred);
+}
@@ -0,0 +1,104 @@
+#ifndef I2C_TARGET_H
+#define I2C_TARGET_H
+
+#include "pico/stdlib.h"
+#include "hardware/i2c.h"
+
+/**
+ * @brief Modo alvo (escravo) I2C: expõe as leituras como mapa de registradores.
+ *
+ * Um controlador agregador lê várias estações no mesmo barramento. O acesso
+ * segue o padrão de sensores: escreve o endereço do registrador e lê (ou
+ * escreve) bytes em sequência, com auto-incremento.
+ *
+ * As leituras vêm de um instantâneo com buffer duplo: o loop principal monta
+ * o próximo instantâneo no buffer de trás e troca os índices; a interrupção
+ * fixa o buffer da frente no primeiro byte de cada leitura e o usa até o
+ * STOP/RESTART. Uma leitura nunca espera pela aquisição e nunca mistura dois
+ * instantâneos. Registradores de configuração são escritos pela interrupção
+ * e aplicados pelo loop (que é o dono do i2c0).
+ *
+ * tools/i2c_master.py lê este cabeçalho para conhecer o mapa.
+ */
+
+#define I2C_TARGET_WHO_AM_I 0xC5
+#define I2C_TARGET_VERSION 1
+
+// --- Instantâneo (somente leitura), multibyte em little-endian ---
+#define REG_WHO_AM_I 0x00 // I2C_TARGET_WHO_AM_I
+#define REG_VERSION 0x01  // I2C_TARGET_VERSION
+#define REG_STATUS 0x02   // bit 0 = cor válida, 1 = lux válido, bits 4-7 = estado da aplicação
+#define REG_ALERTS 0x03   // bit 0 = vermelho, 1 = luz baixa, 2 = deriva; bits 4-6 = canais em deriva
+#define REG_SEQ 0x04      // u32: contador de leituras publicadas
+#define REG_T_MS 0x08     // u32: instante da leitura (ms desde o boot)
+#define REG_RGB 0x0C      // 3 x u8: R, G, B corrigidos e filtrados
+#define REG_LUX 0x10      // u16: lux filtrado
+#define REG_RAW_C 0x12    // u16: contagens brutas do GY-33
+#define REG_RAW_R 0x14
+#define REG_RAW_G 0x16
+#define REG_RAW_B 0x18
+#define REG_SNAPSHOT_END 0x1A
+
+// --- Configuração (leitura e escrita) ---
+#define REG_CFG_ATIME 0x20   // u8: ATIME do GY-33
+#define REG_CFG_LUX_LOW 0x21 // u16: limiar do alerta de luz baixa
+#define REG_CFG_CMD 0x23     // u8: comando (lido de volta como 0 após executado)
+#define REG_CFG_END 0x24
+
+// Bit de um registrador de configuração na máscara de i2c_target_take_writes()
+#define I2C_TARGET_CFG_BIT(reg) (1u << ((reg) - REG_CFG_ATIME))
+
+#define I2C_TARGET_CMD_RELEARN 0x01     // Cor atual vira o alvo das cartas de controle
+#define I2C_TARGET_CMD_RECALIBRATE 0x02 // Volta à calibração de branco
+
+typedef struct
+{
+    uint8_t status;
+    uint8_t alerts;
+    uint32_t t_ms;
+    uint8_t r, g, b;
+    uint16_t lux;
+    uint16_t raw_c, raw_r, raw_g, raw_b;
+} i2c_target_reading_t;
+
+typedef struct
+{
+    uint32_t reads;     // Transações de leitura
+    uint32_t writes;    // Transações com escrita de dados
+    uint32_t published; // Instantâneos publicados
+    uint32_t deferred;  // Publicações adiadas (buffer de trás ainda em leitura)
+} i2c_target_stats_t;
+
+/**
+ * @brief Configura a porta como alvo no endereço dado (pull-ups internos
+ *        habilitados como reforço; o barramento deve ter os seus).
+ */
+void i2c_target_init(i2c_inst_t *i2c, uint sda, uint scl, uint8_t address, uint baudrate);
+
+/**
+ * @brief Publica uma leitura (loop principal). O número de sequência é
+ *        incrementado aqui.
+ *
+ * @return false se o buffer de trás estava sendo lido; a leitura é descartada
+ *         e a próxima publicação tenta de novo.
+ */
+bool i2c_target_publish(const i2c_target_reading_t *reading);
+
+/**
+ * @brief Registradores de configuração escritos pelo controlador desde a
+ *        última chamada (I2C_TARGET_CFG_BIT); limpa a máscara.
+ */
+uint32_t i2c_target_take_writes(void);
+
+uint8_t i2c_target_get_reg(uint8_t reg);
+
+/**
+ * @brief Atualiza um registrador de configuração (valor aplicado, comando concluído).
+ */
+void i2c_target_set_reg(uint8_t reg, uint8_t value);
+
+const i2c_target_stats_t *i2c_target_get_stats(void);
+
+void i2c_target_report(void);
+
+#endif // I2C_TARGET_H
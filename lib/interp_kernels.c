@@ -0,0 +1,175 @@
+#include <stdio.h>
+#include <string.h>
+#include "interp_kernels.h"
+#include "swar.h"
+
+#if PICO_ON_DEVICE
+#include "hardware/interp.h"
+#endif
+
+// --- Versões em C: referência (fora do RP2040, escala e blend usam SWAR) ---
+
+static void lut_u8_c(const uint8_t lut[256], const uint8_t *src, uint8_t *dst, size_t n)
+{
+    for (size_t i = 0; i < n; i++)
+        dst[i] = lut[src[i]];
+}
+
+static void blend_u8_c(const uint8_t *a, const uint8_t *b, uint8_t *dst, size_t n, uint8_t alpha)
+{
+    for (size_t i = 0; i < n; i++)
+        dst[i] = a[i] + ((((int32_t)b[i] - a[i]) * alpha) >> 8);
+}
+
+static void scale_u8_c(const uint8_t *src, uint8_t *dst, size_t n, uint8_t alpha)
+{
+    for (size_t i = 0; i < n; i++)
+        dst[i] = (src[i] * alpha) >> 8;
+}
+
+#if PICO_ON_DEVICE
+// --- Versões com o interpolador ---
+
+// Pistas 0 e 1 indexam a mesma tabela: dois bytes por escrita no acumulador
+static void lut_u8_interp(const uint8_t lut[256], const uint8_t *src, uint8_t *dst, size_t n)
+{
+    interp_config cfg = interp_default_config();
+    interp_config_set_mask(&cfg, 0, 7);
+    interp_set_config(interp0, 0, &cfg);
+    interp_config_set_shift(&cfg, 8);
+    interp_set_config(interp0, 1, &cfg);
+    interp0->base[0] = (uintptr_t)lut;
+    interp0->base[1] = (uintptr_t)lut;
+
+    size_t i = 0;
+    for (; i + 1 < n; i += 2)
+    {
+        uint32_t pair = src[i] | (src[i + 1] << 8);
+        interp0->accum[0] = pair;
+        interp0->accum[1] = pair;
+        dst[i] = *(const uint8_t *)(uintptr_t)interp0->peek[0];
+        dst[i + 1] = *(const uint8_t *)(uintptr_t)interp0->peek[1];
+    }
+    if (i < n)
+        dst[i] = lut[src[i]];
+}
+
+// Modo blend: PEEK1 = BASE0 + (BASE1 - BASE0) * ACCUM1[7:0] / 256
+static void blend_setup(uint8_t alpha)
+{
+    interp_config cfg = interp_default_config();
+    interp_config_set_blend(&cfg, true);
+    interp_set_config(interp0, 0, &cfg);
+    cfg = interp_default_config();
+    interp_set_config(interp0, 1, &cfg);
+    interp0->accum[1] = alpha;
+}
+
+static void blend_u8_interp(const uint8_t *a, const uint8_t *b, uint8_t *dst, size_t n, uint8_t alpha)
+{
+    blend_setup(alpha);
+    for (size_t i = 0; i < n; i++)
+    {
+        interp0->base[0] = a[i];
+        interp0->base[1] = b[i];
+        dst[i] = interp0->peek[1];
+    }
+}
+
+static void scale_u8_interp(const uint8_t *src, uint8_t *dst, size_t n, uint8_t alpha)
+{
+    blend_setup(alpha);
+    interp0->base[0] = 0;
+    for (size_t i = 0; i < n; i++)
+    {
+        interp0->base[1] = src[i];
+        dst[i] = interp0->peek[1];
+    }
+}
+#endif
+
+void kern_lut_u8(const uint8_t lut[256], const uint8_t *src, uint8_t *dst, size_t n)
+{
+#if PICO_ON_DEVICE
+    lut_u8_interp(lut, src, dst, n);
+#else
+    lut_u8_c(lut, src, dst, n);
+#endif
+}
+
+void kern_scale_u8(const uint8_t *src, uint8_t *dst, size_t n, uint8_t alpha)
+{
+#if PICO_ON_DEVICE
+    scale_u8_interp(src, dst, n, alpha);
+#else
+    swar_scale_u8(src, dst, n, alpha);
+#endif
+}
+
+void kern_blend_u8(const uint8_t *a, const uint8_t *b, uint8_t *dst, size_t n, uint8_t alpha)
+{
+#if PICO_ON_DEVICE
+    blend_u8_interp(a, b, dst, n, alpha);
+#else
+    swar_blend_u8(a, b, dst, n, alpha);
+#endif
+}
+
+// --- Benchmark: um quadro da matriz 5x5 (75 bytes) repetido ---
+
+#define KERN_BENCH_BYTES 75
+#define KERN_BENCH_REPS 1000
+
+typedef void (*bench_fn_t)(const uint8_t *a, const uint8_t *b, uint8_t *dst);
+
+static uint8_t bench_lut[256];
+static uint8_t bench_a[KERN_BENCH_BYTES];
+static uint8_t bench_b[KERN_BENCH_BYTES];
+static uint8_t bench_ref[KERN_BENCH_BYTES];
+static uint8_t bench_out[KERN_BENCH_BYTES];
+
+static void bench_lut_c(const uint8_t *a, const uint8_t *b, uint8_t *dst) { (void)b; lut_u8_c(bench_lut, a, dst, KERN_BENCH_BYTES); }
+static void bench_scale_c(const uint8_t *a, const uint8_t *b, uint8_t *dst) { (void)b; scale_u8_c(a, dst, KERN_BENCH_BYTES, 100); }
+static void bench_blend_c(const uint8_t *a, const uint8_t *b, uint8_t *dst) { blend_u8_c(a, b, dst, KERN_BENCH_BYTES, 100); }
+static void bench_lut_k(const uint8_t *a, const uint8_t *b, uint8_t *dst) { (void)b; kern_lut_u8(bench_lut, a, dst, KERN_BENCH_BYTES); }
+static void bench_scale_k(const uint8_t *a, const uint8_t *b, uint8_t *dst) { (void)b; kern_scale_u8(a, dst, KERN_BENCH_BYTES, 100); }
+static void bench_blend_k(const uint8_t *a, const uint8_t *b, uint8_t *dst) { kern_blend_u8(a, b, dst, KERN_BENCH_BYTES, 100); }
+static void bench_scale_s(const uint8_t *a, const uint8_t *b, uint8_t *dst) { (void)b; swar_scale_u8(a, dst, KERN_BENCH_BYTES, 100); }
+static void bench_blend_s(const uint8_t *a, const uint8_t *b, uint8_t *dst) { swar_blend_u8(a, b, dst, KERN_BENCH_BYTES, 100); }
+
+static uint32_t bench_run(bench_fn_t fn, uint8_t *dst)
+{
+    uint32_t t0 = time_us_32();
+    for (int i = 0; i < KERN_BENCH_REPS; i++)
+        fn(bench_a, bench_b, dst);
+    return time_us_32() - t0;
+}
+
+static bool bench_pair(const char *name, bench_fn_t ref, bench_fn_t kern)
+{
+    uint32_t t_ref = bench_run(ref, bench_ref);
+    uint32_t t_kern = bench_run(kern, bench_out);
+    bool same = memcmp(bench_ref, bench_out, KERN_BENCH_BYTES) == 0;
+    printf("  %-6s C %6lu us  kernel %6lu us  %s\n", name, (unsigned long)t_ref, (unsigned long)t_kern,
+           same ? "ok" : "DIFERENTE");
+    return same;
+}
+
+bool kern_benchmark(void)
+{
+    for (int i = 0; i < 256; i++)
+        bench_lut[i] = (i * i) >> 8;
+    for (int i = 0; i < KERN_BENCH_BYTES; i++)
+    {
+        bench_a[i] = i * 37;
+        bench_b[i] = 255 - i * 11;
+    }
+
+    printf("--- Kernels: %d x %d bytes ---\n", KERN_BENCH_REPS, KERN_BENCH_BYTES);
+    bool ok = bench_pair("lut", bench_lut_c, bench_lut_k);
+    ok &= bench_pair("scale", bench_scale_c, bench_scale_k);
+    ok &= bench_pair("blend", bench_blend_c, bench_blend_k);
+    ok &= bench_pair("scale4", bench_scale_c, bench_scale_s);
+    ok &= bench_pair("blend4", bench_blend_c, bench_blend_s);
+    return ok;
+}
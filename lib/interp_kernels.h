@@ -0,0 +1,43 @@
+#ifndef INTERP_KERNELS_H
+#define INTERP_KERNELS_H
+
+#include <stddef.h>
+#include "pico/stdlib.h"
+
+/**
+ * @brief Kernels de tabela e interpolação sobre vetores de bytes.
+ *
+ * No RP2040 usam o interpolador 0 do núcleo chamador (SIO): o cálculo de
+ * endereço da tabela e o lerp de 8 bits são feitos em hardware. Em builds
+ * de host (PICO_ON_DEVICE = 0) caem para C (escala e blend em SWAR, ver
+ * swar.h), com o mesmo resultado. O estado do interp0 não é preservado: não chamar de IRQs
+ * que também o usem.
+ */
+
+/**
+ * @brief dst[i] = lut[src[i]] (ex.: correção gamma).
+ */
+void kern_lut_u8(const uint8_t lut[256], const uint8_t *src, uint8_t *dst, size_t n);
+
+/**
+ * @brief dst[i] = src[i] * alpha / 256 (escala de intensidade em Q8).
+ */
+void kern_scale_u8(const uint8_t *src, uint8_t *dst, size_t n, uint8_t alpha);
+
+/**
+ * @brief dst[i] = a[i] + (b[i] - a[i]) * alpha / 256 (transição entre quadros).
+ */
+void kern_blend_u8(const uint8_t *a, const uint8_t *b, uint8_t *dst, size_t n, uint8_t alpha);
+
+/**
+ * @brief Mede os kernels (e as versões SWAR, "scale4"/"blend4") contra a
+ * versão em C byte a byte, conferindo a igualdade dos resultados.
+ *
+ * Roda também no host (tests/bench_interp_kernels.c), onde mede o caminho
+ * em C/SWAR.
+ *
+ * @return true se todos os resultados coincidem com a referência.
+ */
+bool kern_benchmark(void);
+
+#endif // INTERP_KERNELS_H
@@ -1,5 +1,6 @@
 #include "leds.h"
 #include "hardware/pwm.h"
+#include "hardware/clocks.h"
 #include "matrizRGB.h"
 #include <stdio.h>
 #include <stdlib.h>
@@ -10,6 +11,14 @@ static uint slice_num_red;
 static uint slice_num_green;
 static uint slice_num_blue;
 
+// Divisor que mantém o contador em LED_PWM_COUNTER_HZ em qualquer clk_sys >= 48MHz
+// (o divisor fracionário tem 4 bits: erro < 1% em 133MHz)
+static float led_pwm_clkdiv(void)
+{
+    float div = (float)clock_get_hz(clk_sys) / LED_PWM_COUNTER_HZ;
+    return (div < 1.0f) ? 1.0f : div;
+}
+
 void led_init(void)
 {
     // Configurar os pinos como PWM
@@ -24,7 +33,7 @@ void led_init(void)
     
     // Configurar o PWM para cada slice
     pwm_config config = pwm_get_default_config();
-    pwm_config_set_clkdiv(&config, 1.0f); // Define o divisor de clock para evitar flickering
+    pwm_config_set_clkdiv(&config, led_pwm_clkdiv()); // Define o divisor de clock para evitar flickering
     pwm_config_set_wrap(&config, 4095);   // Mesma resolução do ADC (12 bits)
     
     // Inicializar PWM para cada slice e ativar
@@ -36,6 +45,14 @@ void led_init(void)
     turn_off_leds();
 }
 
+void led_update_clock(void)
+{
+    float div = led_pwm_clkdiv();
+    pwm_set_clkdiv(slice_num_red, div);
+    pwm_set_clkdiv(slice_num_green, div);
+    pwm_set_clkdiv(slice_num_blue, div);
+}
+
 void força_leds(float dutycicle)
 {
     // Limitar o duty cycle entre 0 e 100%
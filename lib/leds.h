@@ -9,8 +9,15 @@
 #define LED_BLUE_PIN 12
 #define LED_RED_PIN 13
 
+// Clock do contador PWM dos LEDs: 48MHz / 4096 ~= 11.7kHz, sem flicker.
+// Igual ao clock ocioso do governador, para a frequência não mudar entre
+// ocioso e rajada; abaixo de 48MHz de clk_sys o divisor fica em 1 e a
+// frequência cai junto com o clock.
+#define LED_PWM_COUNTER_HZ 48000000
+
 // Inicialização dos LEDs
 void led_init(void);
+void led_update_clock(void);
 void força_leds(float dutycicle);
 void acender_led_rgb(uint8_t r, uint8_t g, uint8_t b);
 void turn_off_leds(void);
@@ -15,6 +15,7 @@
 #include <math.h>
 #include "hardware/clocks.h"
 #include "ws2818b.pio.h" 
+#include "swar.h"
 
 /* Estado global da matriz de LEDs */
 npLED_t leds[NP_LED_COUNT];
@@ -25,6 +26,9 @@ const npColor_t npColors[] = {
     COLOR_YELLOW, COLOR_CYAN, COLOR_MAGENTA, COLOR_PURPLE, COLOR_ORANGE,
     COLOR_BROWN, COLOR_VIOLET, COLOR_GREY, COLOR_GOLD, COLOR_SILVER};
 
+/* Taxa de bits do protocolo WS2812B */
+#define NP_BIT_FREQ 800000.0f
+
 /* Estado interno do hardware PIO */
 static PIO np_pio = NULL; // Instância PIO utilizada
 static uint sm = 0;       // State Machine utilizada
@@ -115,6 +119,25 @@ static inline float clampIntensity(float value)
                                                   : value;
 }
 
+/**
+ * @brief Converte a intensidade (0.0 - 1.0) para o fator Q8 dos kernels SWAR
+ */
+static inline uint32_t intensityToAlpha(float value)
+{
+    return (uint32_t)(clampIntensity(value) * SWAR_ALPHA_ONE);
+}
+
+/**
+ * @brief Escala os três canais de uma cor numa única operação SWAR
+ */
+static inline npColor_t scaleColor(npColor_t color, uint32_t alpha)
+{
+    uint32_t packed = color.r | (color.g << 8) | (color.b << 16);
+    packed = swar_scale_word(packed, alpha);
+    npColor_t result = {packed, packed >> 8, packed >> 16};
+    return result;
+}
+
 /**
  * @brief Aplica filtro de ruído e purificação de cor
  *
@@ -285,7 +308,7 @@ void npInit(uint8_t pin)
     }
 
     // Inicializa o programa PIO com a frequência de 800kHz (padrão WS2812B)
-    ws2818b_program_init(np_pio, sm, offset, pin, 800000.0f);
+    ws2818b_program_init(np_pio, sm, offset, pin, NP_BIT_FREQ);
 
     // Limpa a matriz, iniciando com todos os LEDs apagados
     npClear();
@@ -314,6 +337,19 @@ void npClear(void)
     npWrite(); // Atualiza o hardware
 }
 
+void npUpdateClock(void)
+{
+    if (np_pio != NULL)
+    {
+        ws2818b_program_set_freq(np_pio, sm, NP_BIT_FREQ);
+    }
+}
+
+bool npBusy(void)
+{
+    return np_pio != NULL && !pio_sm_is_tx_fifo_empty(np_pio, sm);
+}
+
 bool npIsPositionValid(int x, int y)
 {
     return (x >= 0 && x < NP_MATRIX_WIDTH && y >= 0 && y < NP_MATRIX_HEIGHT);
@@ -348,15 +384,11 @@ void npSetLEDIntensity(int x, int y, npColor_t color, float intensity)
 {
     if (npIsPositionValid(x, y))
     {
-        intensity = clampIntensity(intensity);
         uint index = getIndex(x, y);
 
         // Aplica intensidade primeiro, depois processa a cor
-        uint8_t r = (uint8_t)(color.r * intensity);
-        uint8_t g = (uint8_t)(color.g * intensity);
-        uint8_t b = (uint8_t)(color.b * intensity);
-
-        npColor_t processed = processColor(r, g, b);
+        npColor_t scaled = scaleColor(color, intensityToAlpha(intensity));
+        npColor_t processed = processColor(scaled.r, scaled.g, scaled.b);
         leds[index].R = processed.r;
         leds[index].G = processed.g;
         leds[index].B = processed.b;
@@ -385,14 +417,9 @@ void npSetRowIntensity(int row, npColor_t color, float intensity)
 {
     if (row >= 0 && row < NP_MATRIX_HEIGHT)
     {
-        intensity = clampIntensity(intensity);
-
         // Aplica intensidade e processa a cor
-        uint8_t r = (uint8_t)(color.r * intensity);
-        uint8_t g = (uint8_t)(color.g * intensity);
-        uint8_t b = (uint8_t)(color.b * intensity);
-
-        npColor_t processed = processColor(r, g, b);
+        npColor_t scaled = scaleColor(color, intensityToAlpha(intensity));
+        npColor_t processed = processColor(scaled.r, scaled.g, scaled.b);
 
         for (int x = 0; x < NP_MATRIX_WIDTH; x++)
         {
@@ -427,14 +454,9 @@ void npSetColumnIntensity(int col, npColor_t color, float intensity)
 {
     if (col >= 0 && col < NP_MATRIX_WIDTH)
     {
-        intensity = clampIntensity(intensity);
-
         // Aplica intensidade e processa a cor
-        uint8_t r = (uint8_t)(color.r * intensity);
-        uint8_t g = (uint8_t)(color.g * intensity);
-        uint8_t b = (uint8_t)(color.b * intensity);
-
-        npColor_t processed = processColor(r, g, b);
+        npColor_t scaled = scaleColor(color, intensityToAlpha(intensity));
+        npColor_t processed = processColor(scaled.r, scaled.g, scaled.b);
 
         for (int y = 0; y < NP_MATRIX_HEIGHT; y++)
         {
@@ -551,14 +573,9 @@ void npFillRGBRaw(uint8_t r, uint8_t g, uint8_t b)
 
 void npFillIntensity(npColor_t color, float intensity)
 {
-    intensity = clampIntensity(intensity);
-
     // Aplica intensidade e processa a cor
-    uint8_t r = (uint8_t)(color.r * intensity);
-    uint8_t g = (uint8_t)(color.g * intensity);
-    uint8_t b = (uint8_t)(color.b * intensity);
-
-    npColor_t processed = processColor(r, g, b);
+    npColor_t scaled = scaleColor(color, intensityToAlpha(intensity));
+    npColor_t processed = processColor(scaled.r, scaled.g, scaled.b);
 
     for (int i = 0; i < NP_LED_COUNT; i++)
     {
@@ -571,20 +588,27 @@ void npFillIntensity(npColor_t color, float intensity)
 
 void npSetMatrixWithIntensity(int matriz[NP_MATRIX_HEIGHT][NP_MATRIX_WIDTH][3], float intensity)
 {
-    intensity = clampIntensity(intensity);
+    // Quadro em bytes, na ordem da matriz: a intensidade é aplicada de uma vez
+    uint8_t frame[NP_MATRIX_HEIGHT][NP_MATRIX_WIDTH][3];
+    const int *src = &matriz[0][0][0];
+    uint8_t *dst = &frame[0][0][0];
+    for (uint i = 0; i < sizeof(frame); i++)
+    {
+        int v = src[i];
+        dst[i] = (v < 0) ? 0 : (v > 255) ? 255
+                                          : v;
+    }
+    swar_scale_u8(dst, dst, sizeof(frame), intensityToAlpha(intensity));
 
     // Loop para configurar os LEDs
     for (uint8_t linha = 0; linha < 5; linha++)
     {
         for (uint8_t coluna = 0; coluna < 5; coluna++)
         {
-            // Calcula os valores RGB ajustados pela intensidade
-            uint8_t r = (uint8_t)(float)(matriz[linha][coluna][0] * intensity);
-            uint8_t g = (uint8_t)(float)(matriz[linha][coluna][1] * intensity);
-            uint8_t b = (uint8_t)(float)(matriz[linha][coluna][2] * intensity);
+            const uint8_t *rgb = frame[linha][coluna];
 
             // Processa a cor
-            npColor_t processed = processColor(r, g, b);
+            npColor_t processed = processColor(rgb[0], rgb[1], rgb[2]);
 
             uint index = getIndex(coluna, linha);
 
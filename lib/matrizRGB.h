@@ -103,6 +103,23 @@ void npWrite(void);
  */
 void npClear(void);
 
+/**
+ * @brief Recalcula o divisor do PIO após uma mudança do clock do sistema
+ *
+ * Mantém a taxa de 800kHz do protocolo WS2812B independentemente de clk_sys.
+ */
+void npUpdateClock(void);
+
+/**
+ * @brief Verifica se ainda há dados do último quadro aguardando o PIO
+ *
+ * Com o PIO funcionando, a FIFO esvazia em ~1 ms após npWrite; uma FIFO
+ * que não esvazia indica a state machine parada.
+ *
+ * @return true se a FIFO de transmissão não está vazia
+ */
+bool npBusy(void);
+
 // --- Funções de Correção de Cor (ADICIONADAS) ---
 
 /**
@@ -0,0 +1,100 @@
+#include <stdio.h>
+#include "reg_shadow.h"
+
+void reg_shadow_init(reg_shadow_t *sh, const char *name, uint8_t *values, uint8_t count,
+                     reg_shadow_write_fn write, void *ctx)
+{
+    sh->name = name;
+    sh->count = count;
+    sh->values = values;
+    sh->known = 0;
+    sh->dirty = 0;
+    sh->write = write;
+    sh->ctx = ctx;
+    sh->pending = 0;
+    sh->sent = 0;
+    sh->saved = 0;
+    sh->failed = 0;
+}
+
+bool reg_shadow_write(reg_shadow_t *sh, uint8_t first, const uint8_t *values, uint8_t count)
+{
+    bool changed = false;
+    for (uint8_t i = 0; i < count && first + i < sh->count; i++)
+    {
+        uint8_t reg = first + i;
+        uint32_t bit = 1u << reg;
+        if (((sh->known | sh->dirty) & bit) && sh->values[reg] == values[i])
+            continue;
+        sh->values[reg] = values[i];
+        sh->dirty |= bit;
+        changed = true;
+    }
+
+    if (changed)
+        sh->pending++;
+    else
+        sh->saved++; // Nada muda no dispositivo: a transação inteira é evitada
+    return changed;
+}
+
+int reg_shadow_flush(reg_shadow_t *sh)
+{
+    int transactions = 0;
+    bool ok = true;
+    uint32_t todo = sh->dirty;
+
+    while (todo)
+    {
+        // Estende a rajada até o último registrador sujo alcançável por
+        // registradores de valor conhecido (ou também sujos)
+        uint8_t first = __builtin_ctz(todo);
+        uint8_t last = first;
+        for (uint8_t reg = first + 1; reg < sh->count; reg++)
+        {
+            uint32_t bit = 1u << reg;
+            if (!((sh->known | sh->dirty) & bit))
+                break;
+            if (todo & bit)
+                last = reg;
+        }
+
+        uint8_t count = last - first + 1;
+        uint32_t span = (count == 32 ? ~0u : ((1u << count) - 1)) << first;
+        todo &= ~span;
+        transactions++;
+
+        if (sh->write(sh, first, count))
+        {
+            sh->known |= span & (sh->known | sh->dirty);
+            sh->dirty &= ~span;
+            sh->sent++;
+        }
+        else
+        {
+            // Não se sabe quanto chegou: a faixa inteira fica para a próxima vez
+            sh->dirty |= span & (sh->known | sh->dirty);
+            sh->known &= ~span;
+            sh->failed++;
+            ok = false;
+        }
+    }
+
+    // Escritas agrupadas em menos transações do que o driver faria
+    if (sh->pending > (uint32_t)transactions)
+        sh->saved += sh->pending - transactions;
+    sh->pending = 0;
+    return ok ? transactions : -1;
+}
+
+void reg_shadow_invalidate(reg_shadow_t *sh)
+{
+    sh->dirty |= sh->known;
+    sh->known = 0;
+}
+
+void reg_shadow_report(const reg_shadow_t *sh)
+{
+    printf("Sombra %s: %lu transações enviadas, %lu evitadas, %lu falhas\n",
+           sh->name, sh->sent, sh->saved, sh->failed);
+}
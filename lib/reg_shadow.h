@@ -0,0 +1,88 @@
+#ifndef REG_SHADOW_H
+#define REG_SHADOW_H
+
+#include "pico/stdlib.h"
+
+/**
+ * @brief Cópia local dos registradores de configuração de um dispositivo.
+ *
+ * Guarda o último valor escrito em cada registrador. Escritas que não mudam
+ * nada são descartadas sem tocar no barramento, e os registradores sujos são
+ * enviados no flush em rajadas de endereços contíguos (um registrador limpo
+ * de valor conhecido no meio da faixa é reenviado para não quebrar a rajada).
+ *
+ * O driver fornece a função que envia uma faixa; ela lê os valores em
+ * sh->values[first..first+count-1]. Até 32 registradores por sombra.
+ */
+
+typedef struct reg_shadow reg_shadow_t;
+
+/**
+ * @brief Envia os registradores [first, first + count) ao dispositivo.
+ *
+ * @return false se a transação falhou (NAK, timeout).
+ */
+typedef bool (*reg_shadow_write_fn)(reg_shadow_t *sh, uint8_t first, uint8_t count);
+
+struct reg_shadow
+{
+    const char *name;
+    uint8_t count;
+    uint8_t *values;
+    uint32_t known; // Valor no dispositivo igual ao da sombra
+    uint32_t dirty; // Valor novo ainda não enviado
+    reg_shadow_write_fn write;
+    void *ctx;
+    uint32_t pending; // Escritas que mudaram algo desde o último flush
+
+    // Contadores de transações
+    uint32_t sent;
+    uint32_t saved;
+    uint32_t failed;
+};
+
+/**
+ * @brief Inicializa a sombra com todos os registradores desconhecidos
+ *        (a primeira escrita de cada um sempre chega ao dispositivo).
+ *
+ * @param values Armazenamento de 'count' bytes, indexado pelo registrador.
+ */
+void reg_shadow_init(reg_shadow_t *sh, const char *name, uint8_t *values, uint8_t count,
+                     reg_shadow_write_fn write, void *ctx);
+
+/**
+ * @brief Registra uma escrita de 'count' registradores a partir de 'first'
+ *        (equivale a uma transação no driver original). Nada é enviado
+ *        até reg_shadow_flush.
+ *
+ * @return true se algum valor mudou.
+ */
+bool reg_shadow_write(reg_shadow_t *sh, uint8_t first, const uint8_t *values, uint8_t count);
+
+static inline bool reg_shadow_set(reg_shadow_t *sh, uint8_t reg, uint8_t value)
+{
+    return reg_shadow_write(sh, reg, &value, 1);
+}
+
+static inline uint8_t reg_shadow_get(const reg_shadow_t *sh, uint8_t reg)
+{
+    return sh->values[reg];
+}
+
+/**
+ * @brief Envia os registradores sujos; uma falha deixa a faixa suja para a
+ *        próxima tentativa.
+ *
+ * @return Transações enviadas, ou -1 se alguma falhou.
+ */
+int reg_shadow_flush(reg_shadow_t *sh);
+
+/**
+ * @brief O estado do dispositivo deixou de ser conhecido (reset, reconexão,
+ *        transferência interrompida): o próximo flush reenvia tudo.
+ */
+void reg_shadow_invalidate(reg_shadow_t *sh);
+
+void reg_shadow_report(const reg_shadow_t *sh);
+
+#endif // REG_SHADOW_H
@@ -0,0 +1,309 @@
+#include <stdio.h>
+#include "rs485.h"
+#include "uart_dma.h"
+#include "hardware/gpio.h"
+
+#define RS485_RX_RING_BITS 9 // 512 bytes: folga para mais de dois quadros máximos
+#define RS485_FRAME_MAX (RS485_HEADER_SIZE + RS485_MAX_PAYLOAD + RS485_CRC_SIZE)
+#define RS485_FRAME_GAP_US (4 * RS485_POLL_US) // Silêncio no meio de um quadro: descarta
+
+UART_DMA_RING(rx_ring, RS485_RX_RING_BITS);
+static uart_dma_rx_t rx;
+static uart_dma_tx_t tx;
+static repeating_timer_t poll_timer;
+
+static uint8_t node_addr;
+static uint de_pin;
+static uint32_t char_us; // Duração de um caractere (10 bits)
+
+// Registros: o loop avança head, o timer avança tail (confirmações)
+static rs485_record_t ring[RS485_RING_SIZE];
+static volatile uint32_t head_seq = 0; // Próxima seq a publicar
+static volatile uint32_t tail_seq = 0; // Mais antiga ainda não confirmada
+
+// Quadro em recepção
+static uint8_t frame[RS485_FRAME_MAX];
+static uint16_t frame_len = 0;
+static uint32_t last_byte_us;
+
+// Resposta: montada direto no buffer do DMA
+static uint8_t tx_frame[RS485_FRAME_MAX];
+static uint16_t tx_len;
+static volatile bool tx_active = false; // Do agendamento até o driver desligar
+static bool tx_sending = false;
+
+static rs485_stats_t stats;
+
+uint16_t rs485_crc16(const uint8_t *data, uint32_t len)
+{
+    // Tabela de 16 entradas: um nibble por passo
+    static const uint16_t table[16] = {
+        0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+        0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF};
+    uint16_t crc = 0xFFFF;
+    while (len--)
+    {
+        uint8_t byte = *data++;
+        crc = (crc << 4) ^ table[(crc >> 12) ^ (byte >> 4)];
+        crc = (crc << 4) ^ table[(crc >> 12) ^ (byte & 0x0F)];
+    }
+    return crc;
+}
+
+static uint32_t get_u32(const uint8_t *p)
+{
+    return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static void put_u16(uint8_t *p, uint16_t v)
+{
+    p[0] = v & 0xFF;
+    p[1] = v >> 8;
+}
+
+static void put_u32(uint8_t *p, uint32_t v)
+{
+    put_u16(p, v & 0xFFFF);
+    put_u16(p + 2, v >> 16);
+}
+
+// Liga o driver e dispara o DMA; depois acompanha o fim do envio para
+// desligar o driver assim que o último bit sair do registrador de deslocamento
+static int64_t tx_alarm(alarm_id_t id, void *user_data)
+{
+    (void)id;
+    (void)user_data;
+    if (!tx_sending)
+    {
+        tx_sending = true;
+        gpio_put(de_pin, 1);
+        uart_dma_tx_start(&tx, tx_frame, tx_len);
+        return (int64_t)tx_len * char_us;
+    }
+    if (uart_dma_tx_busy(&tx))
+        return char_us;
+    gpio_put(de_pin, 0);
+    tx_sending = false;
+    tx_active = false;
+    return 0;
+}
+
+// Fecha o quadro de resposta (payload já em tx_frame) e agenda o envio
+static void reply(uint8_t cmd, uint8_t len, uint32_t delay_us)
+{
+    tx_frame[0] = RS485_SYNC;
+    tx_frame[1] = RS485_COLLECTOR;
+    tx_frame[2] = node_addr;
+    tx_frame[3] = cmd | RS485_RSP_FLAG;
+    tx_frame[4] = len;
+    uint16_t crc = rs485_crc16(&tx_frame[1], RS485_HEADER_SIZE - 1 + len);
+    put_u16(&tx_frame[RS485_HEADER_SIZE + len], crc);
+    tx_len = RS485_HEADER_SIZE + len + RS485_CRC_SIZE;
+
+    tx_active = true;
+    if (add_alarm_in_us(delay_us, tx_alarm, NULL, true) < 0)
+    {
+        // Sem alarme o driver nunca seria ligado nem desligado: resposta perdida
+        tx_active = false;
+        stats.tx_no_alarm++;
+        return;
+    }
+    stats.replies++;
+}
+
+// Tudo abaixo de 'ack' chegou ao coletor; acks fora do intervalo são ignorados
+static void apply_ack(uint32_t ack)
+{
+    if (ack - tail_seq <= head_seq - tail_seq)
+        tail_seq = ack;
+}
+
+static uint8_t build_batch(uint8_t max)
+{
+    uint32_t first = tail_seq;
+    uint32_t pending = head_seq - first;
+    uint8_t n = max < RS485_MAX_RECORDS ? max : RS485_MAX_RECORDS;
+    if (n > pending)
+        n = pending;
+
+    uint8_t *p = &tx_frame[RS485_HEADER_SIZE];
+    put_u32(p, first);
+    p[4] = n;
+    p += RS485_BATCH_HEADER;
+    for (uint8_t i = 0; i < n; i++, p += RS485_RECORD_SIZE)
+    {
+        const rs485_record_t *rec = &ring[(first + i) & (RS485_RING_SIZE - 1)];
+        put_u32(p, rec->t_ms);
+        p[4] = rec->r;
+        p[5] = rec->g;
+        p[6] = rec->b;
+        p[7] = rec->alerts;
+        put_u16(p + 8, rec->lux);
+        put_u16(p + 10, rec->clear);
+    }
+    return RS485_BATCH_HEADER + n * RS485_RECORD_SIZE;
+}
+
+static void process_frame(void)
+{
+    uint8_t dst = frame[1];
+    uint8_t cmd = frame[3];
+    uint8_t len = frame[4];
+    const uint8_t *payload = &frame[RS485_HEADER_SIZE];
+
+    stats.frames++;
+    if ((dst != node_addr && dst != RS485_BROADCAST) || (cmd & RS485_RSP_FLAG))
+        return;
+
+    uint32_t delay_us = RS485_TURNAROUND_US;
+    switch (cmd)
+    {
+    case RS485_CMD_PING:
+        if (dst == RS485_BROADCAST)
+            return; // Todos responderiam ao mesmo tempo
+        break;
+    case RS485_CMD_READ:
+        if (dst == RS485_BROADCAST || len < 5)
+            return;
+        break;
+    case RS485_CMD_SLOT_READ:
+    {
+        if (len < 5)
+            return;
+        uint8_t first = payload[3], count = payload[4];
+        uint8_t slot = node_addr - first;
+        if (node_addr < first || slot >= count || len < 5 + 4 * (slot + 1))
+            return;
+        uint16_t slot_us = payload[0] | (payload[1] << 8);
+        delay_us += (uint32_t)slot * slot_us;
+        break;
+    }
+    default:
+        return;
+    }
+
+    // O buffer de envio só é reescrito depois que o driver desligou
+    if (tx_active)
+    {
+        stats.tx_busy++;
+        return;
+    }
+
+    uint8_t out_len;
+    if (cmd == RS485_CMD_PING)
+    {
+        uint8_t *p = &tx_frame[RS485_HEADER_SIZE];
+        p[0] = RS485_VERSION;
+        put_u16(p + 1, head_seq - tail_seq);
+        put_u32(p + 3, head_seq);
+        put_u32(p + 7, stats.dropped);
+        out_len = 11;
+    }
+    else if (cmd == RS485_CMD_READ)
+    {
+        apply_ack(get_u32(payload));
+        out_len = build_batch(payload[4]);
+    }
+    else
+    {
+        uint8_t slot = node_addr - payload[3];
+        apply_ack(get_u32(&payload[5 + 4 * slot]));
+        out_len = build_batch(payload[2]);
+    }
+    reply(cmd, out_len, delay_us);
+}
+
+static void parse_byte(uint8_t byte)
+{
+    if (frame_len == 0 && byte != RS485_SYNC)
+        return;
+    frame[frame_len++] = byte;
+    if (frame_len < RS485_HEADER_SIZE)
+        return;
+
+    uint8_t len = frame[4];
+    if (len > RS485_MAX_PAYLOAD)
+    {
+        frame_len = 0;
+        return;
+    }
+    if (frame_len < RS485_HEADER_SIZE + len + RS485_CRC_SIZE)
+        return;
+
+    uint16_t crc = frame[RS485_HEADER_SIZE + len] | (frame[RS485_HEADER_SIZE + len + 1] << 8);
+    if (crc == rs485_crc16(&frame[1], RS485_HEADER_SIZE - 1 + len))
+        process_frame();
+    else
+        stats.crc_errors++;
+    frame_len = 0;
+}
+
+// Verifica o anel do DMA; os slots são contados a partir desta verificação,
+// então o coletor deve prever RS485_POLL_US de incerteza em cada slot
+static bool rs485_poll(repeating_timer_t *rt)
+{
+    (void)rt;
+    uint32_t now = time_us_32();
+    int c;
+    bool got = false;
+    while ((c = uart_dma_rx_getc(&rx)) >= 0)
+    {
+        parse_byte(c);
+        got = true;
+    }
+    if (got)
+    {
+        last_byte_us = now;
+    }
+    else if (frame_len > 0 && now - last_byte_us > RS485_FRAME_GAP_US)
+    {
+        stats.timeouts++;
+        frame_len = 0;
+    }
+    return true;
+}
+
+void rs485_init(uart_inst_t *uart, uint tx_pin, uint rx_pin, uint de, uint baudrate, uint8_t addr)
+{
+    node_addr = addr;
+    de_pin = de;
+    char_us = 10 * 1000000u / baudrate + 1;
+
+    gpio_init(de_pin);
+    gpio_set_dir(de_pin, GPIO_OUT);
+    gpio_put(de_pin, 0); // Driver desligado: o barramento é do coletor
+
+    uart_init(uart, baudrate);
+    gpio_set_function(tx_pin, GPIO_FUNC_UART);
+    gpio_set_function(rx_pin, GPIO_FUNC_UART);
+
+    uart_dma_rx_init(&rx, uart, rx_ring, RS485_RX_RING_BITS);
+    uart_dma_tx_init(&tx, uart);
+    add_repeating_timer_us(-RS485_POLL_US, rs485_poll, NULL, &poll_timer);
+}
+
+bool rs485_push(const rs485_record_t *rec)
+{
+    uint32_t head = head_seq;
+    if (head - tail_seq >= RS485_RING_SIZE)
+    {
+        stats.dropped++;
+        return false;
+    }
+    ring[head & (RS485_RING_SIZE - 1)] = *rec;
+    head_seq = head + 1; // Publicado só depois do registro completo
+    return true;
+}
+
+const rs485_stats_t *rs485_get_stats(void)
+{
+    return &stats;
+}
+
+void rs485_report(void)
+{
+    printf("RS-485 no %u: %lu quadros, %lu CRC, %lu incompletos, %lu respostas, %lu ocupado, "
+           "%lu sem alarme, %lu registros perdidos, %lu pendentes\n",
+           node_addr, stats.frames, stats.crc_errors, stats.timeouts, stats.replies,
+           stats.tx_busy, stats.tx_no_alarm, stats.dropped, head_seq - tail_seq);
+}
@@ -0,0 +1,102 @@
+#ifndef RS485_H
+#define RS485_H
+
+#include "pico/stdlib.h"
+#include "hardware/uart.h"
+
+/**
+ * @brief Nó do barramento de coleta da linha (UART half-duplex, pronto para RS-485).
+ *
+ * Um coletor interroga várias estações. Cada leitura publicada pela
+ * aplicação vira um registro numerado num buffer local; o coletor lê os
+ * registros em lotes e confirma o último recebido (registros não
+ * confirmados são reenviados no lote seguinte, então uma resposta perdida
+ * não perde amostras).
+ *
+ * Quadro (CRC-16/CCITT-FALSE sobre destino..payload, little-endian):
+ *   SYNC | destino | origem | comando | len | payload[len] | crc_lo | crc_hi
+ *
+ * Agendamento em slots: um RS485_CMD_SLOT_READ em broadcast faz cada nó do
+ * intervalo de endereços responder na sua janela de tempo, contada a partir
+ * do fim do quadro, sem um pedido por nó.
+ *
+ * RX e TX usam DMA (lib/uart_dma): um timer verifica o anel de recepção a
+ * cada RS485_POLL_US e as respostas saem por DMA disparado num alarme. O
+ * pino DE liga o driver só durante o envio. O loop principal apenas publica
+ * registros - a aquisição local não espera pelo barramento.
+ *
+ * tools/rs485_sim.py lê este cabeçalho para conhecer o protocolo.
+ */
+
+#define RS485_VERSION 1
+#define RS485_SYNC 0x7E
+#define RS485_COLLECTOR 0x00 // Endereço do coletor
+#define RS485_BROADCAST 0xFF
+#define RS485_HEADER_SIZE 5 // SYNC, destino, origem, comando, len
+#define RS485_CRC_SIZE 2
+#define RS485_MAX_PAYLOAD 200
+
+// Comandos do coletor; a resposta usa o mesmo código com o bit 7 ligado
+#define RS485_CMD_PING 0x01      // -> versão u8, pendentes u16, próxima seq u32, perdidos u32
+#define RS485_CMD_READ 0x02      // ack u32, max u8 -> lote
+#define RS485_CMD_SLOT_READ 0x03 // slot_us u16, max u8, primeiro u8, n u8, ack u32 x n -> lote no slot
+#define RS485_RSP_FLAG 0x80
+
+// Lote: primeira seq u32, n u8, n registros de RS485_RECORD_SIZE bytes
+#define RS485_BATCH_HEADER 5
+#define RS485_RECORD_SIZE 12 // t_ms u32, r u8, g u8, b u8, alertas u8, lux u16, clear u16
+#define RS485_MAX_RECORDS ((RS485_MAX_PAYLOAD - RS485_BATCH_HEADER) / RS485_RECORD_SIZE)
+#define RS485_LUX_NONE 0xFFFF // BH1750 ausente na amostra
+
+// Registros retidos até a confirmação (potência de 2)
+#define RS485_RING_SIZE 128
+
+// Período de verificação do anel de RX e atraso mínimo antes de responder
+#define RS485_POLL_US 250
+#define RS485_TURNAROUND_US 100
+
+typedef struct
+{
+    uint32_t t_ms;
+    uint8_t r, g, b;
+    uint8_t alerts;
+    uint16_t lux;
+    uint16_t clear;
+} rs485_record_t;
+
+typedef struct
+{
+    uint32_t frames;      // Quadros válidos recebidos (qualquer destino)
+    uint32_t crc_errors;
+    uint32_t timeouts;    // Quadros incompletos descartados
+    uint32_t replies;
+    uint32_t tx_busy;     // Respostas descartadas: envio anterior em andamento
+    uint32_t tx_no_alarm; // Respostas descartadas: nenhum alarme livre para o envio
+    uint32_t dropped;     // Registros perdidos com o buffer cheio
+} rs485_stats_t;
+
+/**
+ * @brief Configura a UART, o pino DE e os canais de DMA, e começa a escutar.
+ *
+ * @param de_pin Pino de habilitação do driver RS-485 (ativo em nível alto).
+ * @param addr Endereço do nó (1..254).
+ */
+void rs485_init(uart_inst_t *uart, uint tx_pin, uint rx_pin, uint de_pin, uint baudrate, uint8_t addr);
+
+/**
+ * @brief Acrescenta um registro ao buffer (loop principal).
+ *
+ * @return false se o buffer está cheio; o registro é descartado.
+ */
+bool rs485_push(const rs485_record_t *rec);
+
+/**
+ * @brief CRC-16/CCITT-FALSE (polinômio 0x1021, inicial 0xFFFF).
+ */
+uint16_t rs485_crc16(const uint8_t *data, uint32_t len);
+
+const rs485_stats_t *rs485_get_stats(void);
+
+void rs485_report(void);
+
+#endif // RS485_H
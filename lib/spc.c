@@ -0,0 +1,83 @@
+#include "spc.h"
+
+static void spc_clear(spc_chart_t *chart)
+{
+    chart->cusum_high = 0;
+    chart->cusum_low = 0;
+    chart->ewma_q4 = chart->target_q4;
+    chart->alarms = 0;
+}
+
+void spc_init(spc_chart_t *chart, uint16_t k, uint16_t h, uint8_t ewma_shift, uint16_t ewma_limit)
+{
+    if (ewma_shift < 1)
+        ewma_shift = 1;
+    if (ewma_shift > 8)
+        ewma_shift = 8;
+    chart->k_q4 = k << 4;
+    chart->h_q4 = h << 4;
+    chart->ewma_shift = ewma_shift;
+    chart->ewma_limit_q4 = ewma_limit << 4;
+    chart->target_q4 = 0;
+    chart->learn_total = 0;
+    chart->learn_count = 0;
+    chart->learn_sum = 0;
+    spc_clear(chart);
+}
+
+void spc_set_target(spc_chart_t *chart, int32_t target)
+{
+    chart->target_q4 = target * 16;
+    chart->learn_total = 0;
+    spc_clear(chart);
+}
+
+void spc_learn(spc_chart_t *chart, uint16_t samples)
+{
+    chart->learn_total = samples;
+    chart->learn_count = 0;
+    chart->learn_sum = 0;
+    chart->alarms = 0;
+}
+
+bool spc_learning(const spc_chart_t *chart)
+{
+    return chart->learn_count < chart->learn_total;
+}
+
+uint8_t spc_update(spc_chart_t *chart, int32_t x)
+{
+    if (spc_learning(chart))
+    {
+        chart->learn_sum += x;
+        if (++chart->learn_count == chart->learn_total)
+        {
+            chart->target_q4 = (chart->learn_sum * 16) / chart->learn_total;
+            spc_clear(chart);
+        }
+        return 0;
+    }
+
+    int32_t dev = x * 16 - chart->target_q4;
+
+    // CUSUM: acumula só o que passa da folga k; limitado em 2h para poder voltar
+    int32_t cap = chart->h_q4 * 2;
+    int32_t hi = chart->cusum_high + dev - chart->k_q4;
+    int32_t lo = chart->cusum_low - dev - chart->k_q4;
+    chart->cusum_high = hi < 0 ? 0 : hi > cap ? cap : hi;
+    chart->cusum_low = lo < 0 ? 0 : lo > cap ? cap : lo;
+
+    // EWMA em Q4
+    chart->ewma_q4 += (x * 16 - chart->ewma_q4) >> chart->ewma_shift;
+    int32_t ewma_dev = chart->ewma_q4 - chart->target_q4;
+
+    uint8_t alarms = 0;
+    if (chart->cusum_high > chart->h_q4)
+        alarms |= SPC_CUSUM_HIGH;
+    if (chart->cusum_low > chart->h_q4)
+        alarms |= SPC_CUSUM_LOW;
+    if (ewma_dev > chart->ewma_limit_q4 || ewma_dev < -chart->ewma_limit_q4)
+        alarms |= SPC_EWMA;
+    chart->alarms = alarms;
+    return alarms;
+}
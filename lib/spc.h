@@ -0,0 +1,71 @@
+#ifndef SPC_H
+#define SPC_H
+
+#include "pico/stdlib.h"
+
+/**
+ * @brief Cartas de controle em tempo real (CUSUM e EWMA) para um canal.
+ *
+ * Detectam deriva lenta em torno de um alvo, que limiares fixos não
+ * enxergam. Tudo em ponto fixo Q4 (x16); cada amostra custa algumas
+ * somas, um shift e comparações.
+ *
+ * O alvo pode ser fixado com spc_set_target ou aprendido como a média
+ * das primeiras amostras após spc_learn.
+ */
+
+// Bits de alarme devolvidos por spc_update
+#define SPC_CUSUM_HIGH 0x01 // Deriva para cima (CUSUM superior acima de h)
+#define SPC_CUSUM_LOW 0x02  // Deriva para baixo (CUSUM inferior acima de h)
+#define SPC_EWMA 0x04       // Média exponencial fora de alvo +- limite
+
+typedef struct
+{
+    int32_t target_q4;
+    int32_t k_q4;        // Folga do CUSUM (metade da deriva a detectar)
+    int32_t h_q4;        // Limiar de decisão do CUSUM
+    int32_t ewma_limit_q4;
+    uint8_t ewma_shift;  // lambda = 1/2^shift
+    int32_t cusum_high;  // Q4
+    int32_t cusum_low;   // Q4
+    int32_t ewma_q4;
+    // Aprendizado do alvo
+    uint16_t learn_total;
+    uint16_t learn_count;
+    int32_t learn_sum;
+    uint8_t alarms;
+} spc_chart_t;
+
+/**
+ * @brief Configura a carta (valores em contagens do canal).
+ *
+ * @param k Folga do CUSUM.
+ * @param h Limiar de decisão do CUSUM.
+ * @param ewma_shift Constante da EWMA (lambda = 1/2^shift).
+ * @param ewma_limit Afastamento máximo da EWMA em relação ao alvo.
+ */
+void spc_init(spc_chart_t *chart, uint16_t k, uint16_t h, uint8_t ewma_shift, uint16_t ewma_limit);
+
+/**
+ * @brief Fixa o alvo e zera as cartas.
+ */
+void spc_set_target(spc_chart_t *chart, int32_t target);
+
+/**
+ * @brief Aprende o alvo como a média das próximas @p samples amostras.
+ *
+ * Durante o aprendizado spc_update não gera alarmes.
+ */
+void spc_learn(spc_chart_t *chart, uint16_t samples);
+
+/**
+ * @brief Inclui uma amostra e devolve os alarmes ativos (SPC_*).
+ */
+uint8_t spc_update(spc_chart_t *chart, int32_t x);
+
+/**
+ * @brief Indica se o alvo ainda está sendo aprendido.
+ */
+bool spc_learning(const spc_chart_t *chart);
+
+#endif // SPC_H
@@ -1,5 +1,9 @@
 #include "ssd1306.h"
 #include "font.h"
+#include "hardware/dma.h"
+#include <string.h>
+
+static bool ssd1306_window_write(reg_shadow_t *sh, uint8_t first, uint8_t count);
 
 void ssd1306_init(ssd1306_t *ssd, uint8_t width, uint8_t height, bool external_vcc, uint8_t address, i2c_inst_t *i2c) {
   ssd->width = width;
@@ -11,37 +15,110 @@ void ssd1306_init(ssd1306_t *ssd, uint8_t width, uint8_t height, bool external_v
   ssd->ram_buffer = calloc(ssd->bufsize, sizeof(uint8_t));
   ssd->ram_buffer[0] = 0x40;
   ssd->port_buffer[0] = 0x80;
+  ssd->transport = SSD1306_TRANSPORT_I2C;
+  reg_shadow_init(&ssd->window, "ssd1306", ssd->window_regs, SSD1306_WIN_REGS, ssd1306_window_write, ssd);
+}
+
+void ssd1306_init_spi(ssd1306_t *ssd, uint8_t width, uint8_t height, bool external_vcc, spi_inst_t *spi,
+                      uint8_t pin_dc, uint8_t pin_cs, uint8_t pin_rst) {
+  ssd1306_init(ssd, width, height, external_vcc, 0, NULL);
+  ssd->transport = SSD1306_TRANSPORT_SPI;
+  ssd->spi_port = spi;
+  ssd->pin_dc = pin_dc;
+  ssd->pin_cs = pin_cs;
+  ssd->pin_rst = pin_rst;
+  ssd->spi_busy = false;
+  ssd->stage_buffer = malloc(ssd->bufsize - 1);
+
+  gpio_init(pin_dc);
+  gpio_set_dir(pin_dc, GPIO_OUT);
+  gpio_init(pin_cs);
+  gpio_set_dir(pin_cs, GPIO_OUT);
+  gpio_put(pin_cs, 1);
+  gpio_init(pin_rst);
+  gpio_set_dir(pin_rst, GPIO_OUT);
+
+  // Pulso de reset (RES# >= 3 us em nível baixo)
+  gpio_put(pin_rst, 1);
+  sleep_ms(1);
+  gpio_put(pin_rst, 0);
+  sleep_us(10);
+  gpio_put(pin_rst, 1);
+  sleep_ms(1);
+
+  // Canal DMA de 8 bits pacejado pelo FIFO de transmissão do SPI
+  ssd->dma_chan = dma_claim_unused_channel(true);
+  dma_channel_config c = dma_channel_get_default_config(ssd->dma_chan);
+  channel_config_set_transfer_data_size(&c, DMA_SIZE_8);
+  channel_config_set_dreq(&c, spi_get_dreq(spi, true));
+  channel_config_set_read_increment(&c, true);
+  channel_config_set_write_increment(&c, false);
+  dma_channel_configure(ssd->dma_chan, &c, &spi_get_hw(spi)->dr, NULL, 0, false);
 }
 
+// Sequência de configuração enviada numa única transação I2C
+static const uint8_t ssd1306_init_cmds[] = {
+  SET_DISP | 0x00,
+  SET_MEM_ADDR, 0x01,
+  SET_DISP_START_LINE | 0x00,
+  SET_SEG_REMAP | 0x01,
+  SET_MUX_RATIO, HEIGHT - 1,
+  SET_COM_OUT_DIR | 0x08,
+  SET_DISP_OFFSET, 0x00,
+  SET_COM_PIN_CFG, 0x12,
+  SET_DISP_CLK_DIV, 0x80,
+  SET_PRECHARGE, 0xF1,
+  SET_VCOM_DESEL, 0x30,
+  SET_CONTRAST, 0xFF,
+  SET_ENTIRE_ON,
+  SET_NORM_INV,
+  SET_CHARGE_PUMP, 0x14,
+  SET_DISP | 0x01
+};
+
 void ssd1306_config(ssd1306_t *ssd) {
-  ssd1306_command(ssd, SET_DISP | 0x00);
-  ssd1306_command(ssd, SET_MEM_ADDR);
-  ssd1306_command(ssd, 0x01);
-  ssd1306_command(ssd, SET_DISP_START_LINE | 0x00);
-  ssd1306_command(ssd, SET_SEG_REMAP | 0x01);
-  ssd1306_command(ssd, SET_MUX_RATIO);
-  ssd1306_command(ssd, HEIGHT - 1);
-  ssd1306_command(ssd, SET_COM_OUT_DIR | 0x08);
-  ssd1306_command(ssd, SET_DISP_OFFSET);
-  ssd1306_command(ssd, 0x00);
-  ssd1306_command(ssd, SET_COM_PIN_CFG);
-  ssd1306_command(ssd, 0x12);
-  ssd1306_command(ssd, SET_DISP_CLK_DIV);
-  ssd1306_command(ssd, 0x80);
-  ssd1306_command(ssd, SET_PRECHARGE);
-  ssd1306_command(ssd, 0xF1);
-  ssd1306_command(ssd, SET_VCOM_DESEL);
-  ssd1306_command(ssd, 0x30);
-  ssd1306_command(ssd, SET_CONTRAST);
-  ssd1306_command(ssd, 0xFF);
-  ssd1306_command(ssd, SET_ENTIRE_ON);
-  ssd1306_command(ssd, SET_NORM_INV);
-  ssd1306_command(ssd, SET_CHARGE_PUMP);
-  ssd1306_command(ssd, 0x14);
-  ssd1306_command(ssd, SET_DISP | 0x01);
+  ssd1306_command_list(ssd, ssd1306_init_cmds, sizeof(ssd1306_init_cmds));
+}
+
+// Aguarda o fim de um envio por DMA (SPI) e libera o CS
+void ssd1306_wait_idle(ssd1306_t *ssd) {
+  if (ssd->transport != SSD1306_TRANSPORT_SPI || !ssd->spi_busy)
+    return;
+  dma_channel_wait_for_finish_blocking(ssd->dma_chan);
+  while (spi_is_busy(ssd->spi_port))
+    tight_loop_contents();
+  gpio_put(ssd->pin_cs, 1);
+  ssd->spi_busy = false;
+}
+
+bool ssd1306_busy(ssd1306_t *ssd) {
+  return ssd->transport == SSD1306_TRANSPORT_SPI && ssd->spi_busy && dma_channel_is_busy(ssd->dma_chan);
+}
+
+// SPI: comandos com D/C em nível baixo, enviados de forma bloqueante
+static void ssd1306_spi_write_commands(ssd1306_t *ssd, const uint8_t *commands, size_t count) {
+  ssd1306_wait_idle(ssd);
+  gpio_put(ssd->pin_dc, 0);
+  gpio_put(ssd->pin_cs, 0);
+  spi_write_blocking(ssd->spi_port, commands, count);
+  gpio_put(ssd->pin_cs, 1);
+}
+
+// SPI: dados com D/C em nível alto, transmitidos por DMA sem ocupar a CPU.
+// O buffer não pode ser liberado antes de ssd1306_wait_idle.
+static void ssd1306_spi_write_data_async(ssd1306_t *ssd, const uint8_t *data, size_t len) {
+  ssd1306_wait_idle(ssd);
+  gpio_put(ssd->pin_dc, 1);
+  gpio_put(ssd->pin_cs, 0);
+  ssd->spi_busy = true;
+  dma_channel_transfer_from_buffer_now(ssd->dma_chan, data, len);
 }
 
 void ssd1306_command(ssd1306_t *ssd, uint8_t command) {
+  if (ssd->transport == SSD1306_TRANSPORT_SPI) {
+    ssd1306_spi_write_commands(ssd, &command, 1);
+    return;
+  }
   ssd->port_buffer[1] = command;
   i2c_write_blocking(
     ssd->i2c_port,
@@ -52,20 +129,109 @@ void ssd1306_command(ssd1306_t *ssd, uint8_t command) {
   );
 }
 
+void ssd1306_command_list(ssd1306_t *ssd, const uint8_t *commands, size_t count) {
+  if (ssd->transport == SSD1306_TRANSPORT_SPI) {
+    ssd1306_spi_write_commands(ssd, commands, count);
+    return;
+  }
+
+  // Byte de controle 0x00 (Co = 0, D/C = 0): todos os bytes seguintes são comandos
+  uint8_t buffer[32];
+  while (count > 0) {
+    size_t chunk = count < sizeof(buffer) - 1 ? count : sizeof(buffer) - 1;
+    buffer[0] = 0x00;
+    for (size_t i = 0; i < chunk; ++i)
+      buffer[i + 1] = commands[i];
+    i2c_write_blocking(ssd->i2c_port, ssd->address, buffer, chunk + 1, false);
+    commands += chunk;
+    count -= chunk;
+  }
+}
+
+// Envia só os comandos da parte da janela que mudou (colunas e/ou páginas)
+static bool ssd1306_window_write(reg_shadow_t *sh, uint8_t first, uint8_t count) {
+  ssd1306_t *ssd = sh->ctx;
+  uint8_t cmds[6];
+  size_t n = 0;
+  if (first <= SSD1306_WIN_COL_END) {
+    cmds[n++] = SET_COL_ADDR;
+    cmds[n++] = sh->values[SSD1306_WIN_COL_START];
+    cmds[n++] = sh->values[SSD1306_WIN_COL_END];
+  }
+  if (first + count > SSD1306_WIN_PAGE_START) {
+    cmds[n++] = SET_PAGE_ADDR;
+    cmds[n++] = sh->values[SSD1306_WIN_PAGE_START];
+    cmds[n++] = sh->values[SSD1306_WIN_PAGE_END];
+  }
+  ssd1306_command_list(ssd, cmds, n);
+  return true;
+}
+
+static void ssd1306_set_window(ssd1306_t *ssd, uint8_t x0, uint8_t x1, uint8_t page0, uint8_t page1) {
+  const uint8_t window[SSD1306_WIN_REGS] = {x0, x1, page0, page1};
+  reg_shadow_write(&ssd->window, 0, window, SSD1306_WIN_REGS);
+  reg_shadow_flush(&ssd->window);
+}
+
+// Transferência I2C incompleta: o ponteiro do controlador parou no meio da janela
+static void ssd1306_i2c_write_data(ssd1306_t *ssd, const uint8_t *data, size_t len) {
+  if (i2c_write_blocking(ssd->i2c_port, ssd->address, data, len, false) != (int)len)
+    reg_shadow_invalidate(&ssd->window);
+}
+
 void ssd1306_send_data(ssd1306_t *ssd) {
-  ssd1306_command(ssd, SET_COL_ADDR);
-  ssd1306_command(ssd, 0);
-  ssd1306_command(ssd, ssd->width - 1);
-  ssd1306_command(ssd, SET_PAGE_ADDR);
-  ssd1306_command(ssd, 0);
-  ssd1306_command(ssd, ssd->pages - 1);
-  i2c_write_blocking(
-    ssd->i2c_port,
-    ssd->address,
-    ssd->ram_buffer,
-    ssd->bufsize,
-    false
-  );
+  ssd1306_set_window(ssd, 0, ssd->width - 1, 0, ssd->pages - 1);
+
+  if (ssd->transport == SSD1306_TRANSPORT_SPI) {
+    // Sem byte de controle em SPI: o quadro começa em ram_buffer[1]
+    ssd1306_spi_write_data_async(ssd, ssd->ram_buffer + 1, ssd->bufsize - 1);
+    return;
+  }
+  ssd1306_i2c_write_data(ssd, ssd->ram_buffer, ssd->bufsize);
+}
+
+void ssd1306_send_region(ssd1306_t *ssd, uint8_t x, uint8_t page, uint8_t width, uint8_t pages) {
+  if (x >= ssd->width || page >= ssd->pages || width == 0 || pages == 0)
+    return;
+  if (x + width > ssd->width)
+    width = ssd->width - x;
+  if (page + pages > ssd->pages)
+    pages = ssd->pages - page;
+
+  ssd1306_set_window(ssd, x, x + width - 1, page, page + pages - 1);
+
+  if (ssd->transport == SSD1306_TRANSPORT_SPI) {
+    const uint8_t *src = &ssd->ram_buffer[1 + x * ssd->pages];
+    if (pages != ssd->pages) {
+      // Recorte de páginas: junta as colunas num buffer de estágio para um único DMA.
+      // Com a janela repetida nenhum comando espera o DMA anterior, que pode
+      // ainda estar lendo este mesmo buffer
+      ssd1306_wait_idle(ssd);
+      size_t len = 0;
+      for (uint8_t col = x; col < x + width; ++col) {
+        memcpy(&ssd->stage_buffer[len], &ssd->ram_buffer[1 + col * ssd->pages + page], pages);
+        len += pages;
+      }
+      src = ssd->stage_buffer;
+    }
+    ssd1306_spi_write_data_async(ssd, src, width * pages);
+    return;
+  }
+
+  // Cada coluna contribui com 'pages' bytes contíguos; agrupa várias colunas
+  // por transação, sempre precedidas do byte de controle de dados (0x40)
+  uint8_t chunk[1 + WIDTH];
+  size_t len = 1;
+  chunk[0] = 0x40;
+  for (uint8_t col = x; col < x + width; ++col) {
+    if (len + pages > sizeof(chunk)) {
+      ssd1306_i2c_write_data(ssd, chunk, len);
+      len = 1;
+    }
+    memcpy(&chunk[len], &ssd->ram_buffer[1 + col * ssd->pages + page], pages);
+    len += pages;
+  }
+  ssd1306_i2c_write_data(ssd, chunk, len);
 }
 
 void ssd1306_pixel(ssd1306_t *ssd, uint8_t x, uint8_t y, bool value) {
@@ -77,23 +243,23 @@ void ssd1306_pixel(ssd1306_t *ssd, uint8_t x, uint8_t y, bool value) {
     ssd->ram_buffer[index] &= ~(1 << pixel);
 }
 
-/*
 void ssd1306_fill(ssd1306_t *ssd, bool value) {
-  uint8_t byte = value ? 0xFF : 0x00;
-  for (uint8_t i = 1; i < ssd->bufsize; ++i)
-    ssd->ram_buffer[i] = byte;
-}*/
-
-void ssd1306_fill(ssd1306_t *ssd, bool value) {
-    // Itera por todas as posições do display
-    for (uint8_t y = 0; y < ssd->height; ++y) {
-        for (uint8_t x = 0; x < ssd->width; ++x) {
-            ssd1306_pixel(ssd, x, y, value);
-        }
-    }
+  // O buffer é feito de bytes de página: preenche direto, sem passar por pixel
+  memset(ssd->ram_buffer + 1, value ? 0xFF : 0x00, ssd->bufsize - 1);
 }
 
-
+void ssd1306_fill_region(ssd1306_t *ssd, uint8_t x, uint8_t page, uint8_t width, uint8_t pages, bool value) {
+  if (x >= ssd->width || page >= ssd->pages)
+    return;
+  if (x + width > ssd->width)
+    width = ssd->width - x;
+  if (page + pages > ssd->pages)
+    pages = ssd->pages - page;
+
+  // Endereçamento vertical: as páginas de uma coluna são contíguas no buffer
+  for (uint8_t col = x; col < x + width; ++col)
+    memset(&ssd->ram_buffer[1 + col * ssd->pages + page], value ? 0xFF : 0x00, pages);
+}
 
 void ssd1306_rect(ssd1306_t *ssd, uint8_t top, uint8_t left, uint8_t width, uint8_t height, bool value, bool fill) {
   for (uint8_t x = left; x < left + width; ++x) {
@@ -192,7 +358,7 @@ void ssd1306_draw_string(ssd1306_t *ssd, const char *str, uint8_t x, uint8_t y)
       x = 0;
       y += 8;
     }
-    if (y + 8 >= ssd->height)
+    if (y + 8 > ssd->height)
     {
       break;
     }
@@ -231,8 +397,8 @@ void ssd1306_draw_bitmap(ssd1306_t *ssd, uint8_t x, uint8_t y, const uint8_t *bi
       uint16_t bitmap_index = x_offset + page * width;
       uint8_t byte = bitmap[bitmap_index];
 
-      // Calcula a posição no buffer do display
-      uint16_t buffer_index = 1 + current_x + (current_page * ssd->width);
+      // Calcula a posição no buffer do display (coluna a coluna: 'pages' bytes por coluna)
+      uint16_t buffer_index = 1 + current_x * ssd->pages + current_page;
 
       // Atualiza o buffer apenas se o índice for válido
       if (buffer_index < ssd->bufsize)
@@ -1,6 +1,11 @@
+#ifndef SSD1306_H
+#define SSD1306_H
+
 #include <stdlib.h>
 #include "pico/stdlib.h"
 #include "hardware/i2c.h"
+#include "hardware/spi.h"
+#include "reg_shadow.h"
 
 #define WIDTH 128
 #define HEIGHT 64
@@ -26,6 +31,22 @@ typedef enum
   SET_CHARGE_PUMP = 0x8D
 } ssd1306_command_t;
 
+typedef enum
+{
+  SSD1306_TRANSPORT_I2C,
+  SSD1306_TRANSPORT_SPI
+} ssd1306_transport_t;
+
+// Janela de endereçamento na sombra: coluna inicial/final, página inicial/final
+enum
+{
+  SSD1306_WIN_COL_START,
+  SSD1306_WIN_COL_END,
+  SSD1306_WIN_PAGE_START,
+  SSD1306_WIN_PAGE_END,
+  SSD1306_WIN_REGS
+};
+
 typedef struct
 {
   uint8_t width, height, pages, address;
@@ -34,19 +55,41 @@ typedef struct
   uint8_t *ram_buffer;
   size_t bufsize;
   uint8_t port_buffer[2];
+  // Transporte escolhido na inicialização (mesma API de desenho para ambos)
+  ssd1306_transport_t transport;
+  spi_inst_t *spi_port;
+  uint8_t pin_dc, pin_cs, pin_rst;
+  int dma_chan;
+  volatile bool spi_busy;  // DMA de dados em andamento (CS ainda ativo)
+  uint8_t *stage_buffer;   // Estágio para regiões que não ocupam todas as páginas
+  // Última janela enviada: cada envio completo volta o ponteiro ao início
+  // dela, então repetir a mesma janela não precisa de comandos
+  reg_shadow_t window;
+  uint8_t window_regs[SSD1306_WIN_REGS];
 } ssd1306_t;
 
 void ssd1306_init(ssd1306_t *ssd, uint8_t width, uint8_t height, bool external_vcc, uint8_t address, i2c_inst_t *i2c);
+void ssd1306_init_spi(ssd1306_t *ssd, uint8_t width, uint8_t height, bool external_vcc, spi_inst_t *spi,
+                      uint8_t pin_dc, uint8_t pin_cs, uint8_t pin_rst);
 void ssd1306_config(ssd1306_t *ssd);
+void ssd1306_wait_idle(ssd1306_t *ssd);
+// true enquanto o DMA de um quadro SPI transmite (o I2C é sempre bloqueante)
+bool ssd1306_busy(ssd1306_t *ssd);
 void ssd1306_command(ssd1306_t *ssd, uint8_t command);
+void ssd1306_command_list(ssd1306_t *ssd, const uint8_t *commands, size_t count);
 void ssd1306_send_data(ssd1306_t *ssd);
+void ssd1306_send_region(ssd1306_t *ssd, uint8_t x, uint8_t page, uint8_t width, uint8_t pages);
 
 void ssd1306_pixel(ssd1306_t *ssd, uint8_t x, uint8_t y, bool value);
 void ssd1306_fill(ssd1306_t *ssd, bool value);
+void ssd1306_fill_region(ssd1306_t *ssd, uint8_t x, uint8_t page, uint8_t width, uint8_t pages, bool value);
 void ssd1306_rect(ssd1306_t *ssd, uint8_t top, uint8_t left, uint8_t width, uint8_t height, bool value, bool fill);
 void ssd1306_line(ssd1306_t *ssd, uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, bool value);
 void ssd1306_hline(ssd1306_t *ssd, uint8_t x0, uint8_t x1, uint8_t y, bool value);
 void ssd1306_vline(ssd1306_t *ssd, uint8_t x, uint8_t y0, uint8_t y1, bool value);
 void ssd1306_draw_char(ssd1306_t *ssd, char c, uint8_t x, uint8_t y);
 void ssd1306_draw_string(ssd1306_t *ssd, const char *str, uint8_t x, uint8_t y);
-void ssd1306_draw_bitmap(ssd1306_t *ssd, uint8_t x, uint8_t y, const uint8_t *bitmap, uint8_t width, uint8_t height);
\ No newline at end of file
+// Bitmap em bytes de página: 'width' bytes por página, bit 0 no topo (y alinhado a página)
+void ssd1306_draw_bitmap(ssd1306_t *ssd, uint8_t x, uint8_t y, const uint8_t *bitmap, uint8_t width, uint8_t height);
+
+#endif // SSD1306_H
@@ -0,0 +1,215 @@
+#include <stdio.h>
+#include <string.h>
+#include "supervisor.h"
+#include "hardware/watchdog.h"
+#include "hardware/sync.h"
+
+#define SUP_MAGIC 0x53555056u // "SUPV"
+
+typedef struct
+{
+    uint32_t t_us;
+    uint32_t arg;
+    char tag[SUP_TAG_LEN];
+} sup_event_t;
+
+typedef struct
+{
+    char name[SUP_TAG_LEN];
+    uint32_t deadline_ms;
+    uint32_t elapsed_ms; // Desde o último check-in, no instante da falha
+    bool active;
+} sup_task_record_t;
+
+// Sobrevive ao reset: o crt0 não zera .uninitialized_data
+typedef struct
+{
+    uint32_t magic;      // Trace escrito por este firmware
+    uint32_t trace_head; // Total de eventos (índice = head % SUP_TRACE_LEN)
+    sup_event_t trace[SUP_TRACE_LEN];
+
+    // Registro da falha, válido com miss_magic == SUP_MAGIC (gravado por último)
+    uint32_t miss_magic;
+    uint32_t miss_t_us;
+    uint8_t miss_task;
+    uint8_t task_count;
+    sup_task_record_t tasks[SUP_MAX_TASKS];
+} sup_noinit_t;
+
+static sup_noinit_t __uninitialized_ram(noinit);
+
+// Cópia do que o boot anterior deixou
+static sup_noinit_t prev;
+static bool prev_trace, prev_miss;
+
+typedef struct
+{
+    const char *name;
+    uint32_t deadline_us;
+    volatile uint32_t last_us;
+    volatile bool active;
+} sup_task_state_t;
+
+static sup_task_state_t tasks[SUP_MAX_TASKS];
+static uint8_t task_count;
+static repeating_timer_t check_timer;
+static volatile bool missed; // Falha registrada: trace congelado, watchdog sem alimentação
+
+static void copy_tag(char *dst, const char *src)
+{
+    strncpy(dst, src, SUP_TAG_LEN - 1);
+    dst[SUP_TAG_LEN - 1] = '\0';
+}
+
+void supervisor_init(void)
+{
+    prev_trace = noinit.magic == SUP_MAGIC;
+    prev_miss = prev_trace && noinit.miss_magic == SUP_MAGIC && noinit.task_count <= SUP_MAX_TASKS &&
+                noinit.miss_task < noinit.task_count;
+    if (prev_trace)
+        prev = noinit;
+
+    memset(&noinit, 0, sizeof(noinit));
+    noinit.magic = SUP_MAGIC;
+}
+
+sup_task_t supervisor_register(const char *name, uint32_t deadline_ms)
+{
+    hard_assert(task_count < SUP_MAX_TASKS);
+    sup_task_state_t *t = &tasks[task_count];
+    t->name = name;
+    t->deadline_us = deadline_ms * 1000;
+    t->last_us = time_us_32();
+    t->active = true;
+    return task_count++;
+}
+
+void supervisor_checkin(sup_task_t task)
+{
+    tasks[task].last_us = time_us_32();
+}
+
+void supervisor_set_active(sup_task_t task, bool active)
+{
+    // Prazo reiniciado antes de a tarefa voltar a ser verificada
+    if (active)
+        tasks[task].last_us = time_us_32();
+    tasks[task].active = active;
+}
+
+void supervisor_trace(const char *tag, uint32_t arg)
+{
+    if (missed)
+        return;
+    sup_event_t *ev = &noinit.trace[noinit.trace_head % SUP_TRACE_LEN];
+    ev->t_us = time_us_32();
+    ev->arg = arg;
+    copy_tag(ev->tag, tag);
+    noinit.trace_head++;
+}
+
+// Foto de todas as tarefas: um loop travado atrasa várias, o trace diz onde
+static void record_miss(uint8_t worst, uint32_t now)
+{
+    noinit.miss_t_us = now;
+    noinit.miss_task = worst;
+    noinit.task_count = task_count;
+    for (uint8_t i = 0; i < task_count; i++)
+    {
+        sup_task_record_t *rec = &noinit.tasks[i];
+        copy_tag(rec->name, tasks[i].name);
+        rec->deadline_ms = tasks[i].deadline_us / 1000;
+        rec->elapsed_ms = (now - tasks[i].last_us) / 1000;
+        rec->active = tasks[i].active;
+    }
+    noinit.miss_magic = SUP_MAGIC;
+}
+
+static bool check_deadlines(repeating_timer_t *rt)
+{
+    (void)rt;
+    // Depois da falha o watchdog não é mais alimentado: o reset vem sozinho
+    if (missed)
+        return true;
+
+    uint32_t now = time_us_32();
+    int worst = -1;
+    uint32_t worst_over = 0;
+    for (uint8_t i = 0; i < task_count; i++)
+    {
+        if (!tasks[i].active)
+            continue;
+        uint32_t elapsed = now - tasks[i].last_us;
+        if (elapsed > tasks[i].deadline_us && elapsed - tasks[i].deadline_us >= worst_over)
+        {
+            worst = i;
+            worst_over = elapsed - tasks[i].deadline_us;
+        }
+    }
+
+    if (worst < 0)
+    {
+        watchdog_update();
+        return true;
+    }
+    missed = true;
+    record_miss(worst, now);
+    return true;
+}
+
+void supervisor_run(void)
+{
+    uint32_t now = time_us_32();
+    for (uint8_t i = 0; i < task_count; i++)
+        tasks[i].last_us = now;
+
+    // Alarme de hardware próprio, com IRQ neste núcleo: uma IRQ travada no
+    // núcleo 0 (I2C na aquisição) não impede a verificação
+    alarm_pool_t *pool = alarm_pool_create_with_unused_hardware_alarm(1);
+    watchdog_enable(SUP_WATCHDOG_MS, true);
+    alarm_pool_add_repeating_timer_ms(pool, -SUP_CHECK_MS, check_deadlines, NULL, &check_timer);
+
+    while (true)
+        __wfi();
+}
+
+void supervisor_report_reset(void)
+{
+    if (!watchdog_enable_caused_reboot())
+    {
+        printf("Reset: %s\n", watchdog_caused_reboot() ? "watchdog_reboot" : "energia/RUN");
+        return;
+    }
+
+    if (prev_miss)
+    {
+        const sup_task_record_t *miss = &prev.tasks[prev.miss_task];
+        printf("Reset pelo watchdog: %.*s sem check-in por %lu ms (prazo %lu ms)\n", SUP_TAG_LEN, miss->name,
+               miss->elapsed_ms, miss->deadline_ms);
+        for (uint8_t i = 0; i < prev.task_count; i++)
+        {
+            const sup_task_record_t *rec = &prev.tasks[i];
+            printf("  %-*.*s %6lu ms / %5lu ms%s\n", SUP_TAG_LEN, SUP_TAG_LEN, rec->name, rec->elapsed_ms,
+                   rec->deadline_ms,
+                   !rec->active ? "  parada" : rec->elapsed_ms > rec->deadline_ms ? "  ATRASADA" : "");
+        }
+    }
+    else
+    {
+        // O supervisor também parou (núcleo 1 travado ou IRQs desligadas nele)
+        printf("Reset pelo watchdog sem registro de tarefa\n");
+    }
+
+    if (!prev_trace || prev.trace_head == 0)
+        return;
+
+    // Tempos relativos à falha (ou ao último evento, sem registro)
+    uint32_t count = prev.trace_head < SUP_TRACE_LEN ? prev.trace_head : SUP_TRACE_LEN;
+    uint32_t ref_us = prev_miss ? prev.miss_t_us : prev.trace[(prev.trace_head - 1) % SUP_TRACE_LEN].t_us;
+    printf("Últimos eventos:\n");
+    for (uint32_t n = prev.trace_head - count; n != prev.trace_head; n++)
+    {
+        const sup_event_t *ev = &prev.trace[n % SUP_TRACE_LEN];
+        printf("  -%6lu ms %-*.*s %lu\n", (ref_us - ev->t_us) / 1000, SUP_TAG_LEN, SUP_TAG_LEN, ev->tag, ev->arg);
+    }
+}
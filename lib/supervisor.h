@@ -0,0 +1,73 @@
+#ifndef SUPERVISOR_H
+#define SUPERVISOR_H
+
+#include "pico/stdlib.h"
+
+/**
+ * @brief Watchdog por tarefa com registro da falha que causou o reset.
+ *
+ * Cada tarefa registrada faz check-in ao concluir um passo do seu trabalho.
+ * O supervisor roda no núcleo 1, com um timer próprio, e só alimenta o
+ * watchdog de hardware enquanto toda tarefa ativa fez check-in dentro do
+ * seu prazo. Ao primeiro prazo perdido ele grava na RAM não inicializada
+ * qual tarefa atrasou, de quanto, e os últimos eventos de trace; depois
+ * para de alimentar o watchdog e o chip reinicia em SUP_WATCHDOG_MS. O
+ * registro sobrevive ao reset e é impresso no boot seguinte.
+ *
+ * Se o próprio núcleo 1 travar, o watchdog reinicia sem registro; o trace
+ * (também na RAM não inicializada) continua disponível.
+ */
+
+#define SUP_MAX_TASKS 6
+#define SUP_TRACE_LEN 16    // Últimos eventos guardados (potência de 2)
+#define SUP_TAG_LEN 8       // Nome de tarefa/evento copiado para o registro
+#define SUP_CHECK_MS 50     // Período da verificação dos prazos
+#define SUP_WATCHDOG_MS 500 // Reset após a última alimentação
+
+typedef uint8_t sup_task_t;
+
+/**
+ * @brief Recupera o registro deixado pelo reset anterior e prepara a RAM
+ *        não inicializada para este boot. Chamar no início de main, antes
+ *        de qualquer supervisor_trace.
+ */
+void supervisor_init(void);
+
+/**
+ * @brief Registra uma tarefa (antes de supervisor_run), começando ativa.
+ *
+ * @param name Nome (até SUP_TAG_LEN - 1 caracteres vão para o registro).
+ * @param deadline_ms Intervalo máximo entre dois check-ins.
+ * @return Identificador para check-in.
+ */
+sup_task_t supervisor_register(const char *name, uint32_t deadline_ms);
+
+/**
+ * @brief Passo concluído: reinicia o prazo da tarefa. Seguro em IRQ.
+ */
+void supervisor_checkin(sup_task_t task);
+
+/**
+ * @brief Tarefa parada (subsistema desligado) não tem prazo; ao voltar,
+ *        o prazo conta a partir daqui.
+ */
+void supervisor_set_active(sup_task_t task, bool active);
+
+/**
+ * @brief Evento no trace circular (só do núcleo 0).
+ *
+ * @param tag Texto curto (copiado: não precisa sobreviver ao reset).
+ */
+void supervisor_trace(const char *tag, uint32_t arg);
+
+/**
+ * @brief Liga o watchdog e verifica os prazos no núcleo atual. Não retorna.
+ */
+void supervisor_run(void);
+
+/**
+ * @brief Imprime a causa do último reset e, se foi o watchdog, o registro.
+ */
+void supervisor_report_reset(void);
+
+#endif // SUPERVISOR_H
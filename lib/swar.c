@@ -0,0 +1,49 @@
+#include <string.h>
+#include "swar.h"
+
+// As palavras passam por memcpy: quadros npLED_t (3 bytes) e linhas do
+// display não têm alinhamento garantido, e o Cortex-M0+ não faz acesso
+// desalinhado. O compilador reduz memcpy de 4 bytes a cargas simples
+// quando o ponteiro é alinhado.
+
+static inline uint32_t load_word(const uint8_t *p)
+{
+    uint32_t w;
+    memcpy(&w, p, sizeof(w));
+    return w;
+}
+
+static inline void store_word(uint8_t *p, uint32_t w)
+{
+    memcpy(p, &w, sizeof(w));
+}
+
+void swar_scale_u8(const uint8_t *src, uint8_t *dst, size_t n, uint32_t alpha)
+{
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+        store_word(dst + i, swar_scale_word(load_word(src + i), alpha));
+    for (; i < n; i++)
+        dst[i] = (src[i] * alpha) >> 8;
+}
+
+void swar_blend_u8(const uint8_t *a, const uint8_t *b, uint8_t *dst, size_t n, uint32_t alpha)
+{
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+        store_word(dst + i, swar_blend_word(load_word(a + i), load_word(b + i), alpha));
+    for (; i < n; i++)
+        dst[i] = a[i] + ((((int32_t)b[i] - a[i]) * (int32_t)alpha) >> 8);
+}
+
+void swar_add_sat_u8(const uint8_t *a, const uint8_t *b, uint8_t *dst, size_t n)
+{
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+        store_word(dst + i, swar_add_sat_word(load_word(a + i), load_word(b + i)));
+    for (; i < n; i++)
+    {
+        uint32_t sum = a[i] + b[i];
+        dst[i] = sum > 255 ? 255 : sum;
+    }
+}
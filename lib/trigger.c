@@ -0,0 +1,219 @@
+#include <stdio.h>
+#include "trigger.h"
+#include "gy33.h"
+#include "hardware/gpio.h"
+#include "hardware/sync.h"
+
+// Folga após o fim nominal da integração antes de desistir da captura
+#define TRIGGER_TIMEOUT_US 5000
+
+static uint trigger_pin;
+static uint32_t trigger_edge;
+static uint32_t delay_us = 0;
+
+static volatile trigger_state_t state = TRIGGER_OFF;
+static volatile uint64_t trigger_us;
+static volatile uint64_t start_us;
+static alarm_id_t delay_alarm = 0;
+static uint32_t seq = 0;
+
+static trigger_stats_t stats;
+
+// Inicia a integração e mede o atraso desde a borda (contexto de IRQ)
+static void trigger_start(void)
+{
+    gy33_start_integration();
+    uint64_t now = time_us_64();
+    start_us = now;
+
+    uint32_t start_latency = (uint32_t)(now - trigger_us) - delay_us;
+    if (start_latency < stats.start_min_us)
+        stats.start_min_us = start_latency;
+    if (start_latency > stats.start_max_us)
+        stats.start_max_us = start_latency;
+
+    state = TRIGGER_INTEGRATING;
+}
+
+static int64_t trigger_delay_cb(alarm_id_t id, void *user_data)
+{
+    (void)id;
+    (void)user_data;
+    delay_alarm = 0;
+    if (state == TRIGGER_DELAYING)
+        trigger_start();
+    return 0; // Não repete
+}
+
+// Tratador dedicado ao pino: não passa pelo callback (com debounce) dos botões
+static void trigger_irq_handler(void)
+{
+    if (!(gpio_get_irq_event_mask(trigger_pin) & trigger_edge))
+        return;
+    gpio_acknowledge_irq(trigger_pin, trigger_edge);
+
+    uint64_t now = time_us_64();
+    if (state != TRIGGER_ARMED)
+    {
+        stats.missed++;
+        return;
+    }
+    trigger_us = now;
+
+    if (delay_us == 0)
+    {
+        trigger_start();
+        return;
+    }
+
+    state = TRIGGER_DELAYING;
+    delay_alarm = add_alarm_in_us(delay_us, trigger_delay_cb, NULL, true);
+    if (delay_alarm <= 0)
+    {
+        // Sem alarme disponível (ou atraso já vencido): inicia agora
+        delay_alarm = 0;
+        trigger_start();
+    }
+}
+
+void trigger_init(uint pin, uint32_t edge)
+{
+    trigger_pin = pin;
+    trigger_edge = edge;
+
+    gpio_init(pin);
+    gpio_set_dir(pin, GPIO_IN);
+    gpio_pull_up(pin);
+    gpio_add_raw_irq_handler(pin, trigger_irq_handler);
+    irq_set_enabled(IO_IRQ_BANK0, true);
+
+    trigger_reset_stats();
+}
+
+void trigger_set_delay_us(uint32_t us)
+{
+    delay_us = us;
+}
+
+void trigger_enable(bool enable)
+{
+    if (enable == (state != TRIGGER_OFF))
+        return;
+
+    if (enable)
+    {
+        // ADC parado: a integração começa no instante do comando de início
+        gy33_stop_integration();
+        gpio_acknowledge_irq(trigger_pin, trigger_edge);
+        state = TRIGGER_ARMED;
+        gpio_set_irq_enabled(trigger_pin, trigger_edge, true);
+        return;
+    }
+
+    gpio_set_irq_enabled(trigger_pin, trigger_edge, false);
+    uint32_t irq_state = save_and_disable_interrupts();
+    if (delay_alarm)
+    {
+        cancel_alarm(delay_alarm);
+        delay_alarm = 0;
+    }
+    state = TRIGGER_OFF;
+    restore_interrupts(irq_state);
+    gy33_start_integration();
+}
+
+bool trigger_poll(trigger_capture_t *cap)
+{
+    if (state != TRIGGER_INTEGRATING)
+        return false;
+
+    uint64_t now = time_us_64();
+    uint64_t done_us = start_us + gy33_integration_time_us();
+    if (now < done_us)
+        return false;
+
+    // A partir daqui a interrupção não toca mais no barramento
+    state = TRIGGER_READING;
+    if (!gy33_data_ready())
+    {
+        if (now < done_us + TRIGGER_TIMEOUT_US)
+        {
+            state = TRIGGER_INTEGRATING;
+            return false;
+        }
+        stats.timeouts++;
+        trigger_rearm();
+        return false;
+    }
+
+    if (!gy33_read_raw_crgb(&cap->c, &cap->r, &cap->g, &cap->b))
+    {
+        // Sensor caiu entre o AVALID e a leitura: captura perdida
+        stats.timeouts++;
+        trigger_rearm();
+        return false;
+    }
+    cap->result_us = time_us_64();
+    cap->trigger_us = trigger_us;
+    cap->start_us = start_us;
+    cap->seq = seq++;
+
+    uint32_t latency = (uint32_t)(cap->result_us - cap->trigger_us);
+    if (latency < stats.latency_min_us)
+        stats.latency_min_us = latency;
+    if (latency > stats.latency_max_us)
+        stats.latency_max_us = latency;
+    stats.latency_sum_us += latency;
+    stats.captures++;
+    return true;
+}
+
+void trigger_rearm(void)
+{
+    if (state != TRIGGER_READING)
+        return;
+    gy33_stop_integration();
+    state = TRIGGER_ARMED;
+}
+
+trigger_state_t trigger_get_state(void)
+{
+    return state;
+}
+
+absolute_time_t trigger_next_deadline(void)
+{
+    if (state != TRIGGER_INTEGRATING)
+        return at_the_end_of_time;
+    return from_us_since_boot(start_us + gy33_integration_time_us());
+}
+
+const trigger_stats_t *trigger_get_stats(void)
+{
+    return &stats;
+}
+
+void trigger_reset_stats(void)
+{
+    uint32_t irq_state = save_and_disable_interrupts();
+    stats = (trigger_stats_t){
+        .latency_min_us = UINT32_MAX,
+        .start_min_us = UINT32_MAX,
+    };
+    restore_interrupts(irq_state);
+}
+
+void trigger_report(void)
+{
+    if (stats.captures == 0)
+    {
+        printf("Disparo: nenhuma captura (%lu perdidas)\n", stats.missed);
+        return;
+    }
+    printf("Disparo: %lu capturas, %lu perdidas, %lu timeouts\n",
+           stats.captures, stats.missed, stats.timeouts);
+    printf("  latencia borda->resultado min %lu us  max %lu us  media %llu us\n",
+           stats.latency_min_us, stats.latency_max_us, stats.latency_sum_us / stats.captures);
+    printf("  inicio da integracao min %lu us  max %lu us  jitter %lu us\n",
+           stats.start_min_us, stats.start_max_us, stats.start_max_us - stats.start_min_us);
+}
@@ -0,0 +1,102 @@
+#ifndef TRIGGER_H
+#define TRIGGER_H
+
+#include "pico/stdlib.h"
+
+/**
+ * @brief Captura disparada por borda externa (ex.: barreira óptica da esteira).
+ *
+ * A borda no pino de disparo inicia a integração do GY-33 dentro da própria
+ * interrupção (ou num alarme, se houver atraso programado). O loop principal
+ * só lê o resultado quando a integração termina. Requer o GY-33 em I2C.
+ *
+ * O barramento i2c0 tem um dono por vez: a interrupção só o usa com a
+ * máquina em TRIGGER_ARMED, e o loop só o usa em TRIGGER_READING.
+ * Bordas que chegam fora de TRIGGER_ARMED são contadas como perdidas.
+ */
+
+typedef enum
+{
+    TRIGGER_OFF,         // Modo desligado: GY-33 em integração contínua
+    TRIGGER_ARMED,       // Aguardando borda, ADC parado
+    TRIGGER_DELAYING,    // Borda recebida, aguardando o atraso programado
+    TRIGGER_INTEGRATING, // Integração em andamento
+    TRIGGER_READING      // Loop principal lendo o resultado
+} trigger_state_t;
+
+// Resultado de uma captura, marcado com o instante da borda
+typedef struct
+{
+    uint32_t seq;
+    uint64_t trigger_us; // Borda no pino
+    uint64_t start_us;   // Comando de início da integração concluído
+    uint64_t result_us;  // Dados lidos
+    uint16_t c, r, g, b; // Contagens brutas
+} trigger_capture_t;
+
+typedef struct
+{
+    uint32_t captures;
+    uint32_t missed;   // Bordas com uma captura ainda em andamento
+    uint32_t timeouts; // Integrações que não ficaram prontas a tempo
+    // Borda -> resultado
+    uint32_t latency_min_us;
+    uint32_t latency_max_us;
+    uint64_t latency_sum_us;
+    // Borda -> início da integração, sem o atraso programado (jitter = max - min)
+    uint32_t start_min_us;
+    uint32_t start_max_us;
+} trigger_stats_t;
+
+/**
+ * @brief Configura o pino de disparo (entrada com pull-up) sem habilitá-lo.
+ *
+ * @param edge GPIO_IRQ_EDGE_FALL ou GPIO_IRQ_EDGE_RISE.
+ */
+void trigger_init(uint pin, uint32_t edge);
+
+/**
+ * @brief Atraso entre a borda e o início da integração (0 = imediato).
+ */
+void trigger_set_delay_us(uint32_t delay_us);
+
+/**
+ * @brief Liga ou desliga o modo disparado.
+ *
+ * Ao ligar, o ADC do GY-33 é parado e a máquina fica armada. Ao desligar,
+ * a integração contínua é retomada.
+ */
+void trigger_enable(bool enable);
+
+/**
+ * @brief Lê a captura em andamento, se a integração já terminou.
+ *
+ * Chamado pelo loop principal. Ao retornar true a máquina fica em
+ * TRIGGER_READING: o i2c0 é do chamador (ex.: para ler o BH1750) até
+ * trigger_rearm().
+ *
+ * @return true se @p cap recebeu uma nova captura.
+ */
+bool trigger_poll(trigger_capture_t *cap);
+
+/**
+ * @brief Devolve o barramento e arma a próxima captura.
+ */
+void trigger_rearm(void);
+
+trigger_state_t trigger_get_state(void);
+
+/**
+ * @brief Próximo instante em que trigger_poll pode ter trabalho.
+ */
+absolute_time_t trigger_next_deadline(void);
+
+const trigger_stats_t *trigger_get_stats(void);
+void trigger_reset_stats(void);
+
+/**
+ * @brief Imprime capturas, perdas, latência e jitter acumulados.
+ */
+void trigger_report(void);
+
+#endif // TRIGGER_H
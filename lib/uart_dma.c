@@ -0,0 +1,100 @@
+#include "uart_dma.h"
+#include "hardware/dma.h"
+
+// Bytes por bloco do canal de dados. Ao fim de cada bloco o canal de
+// recarga reescreve a contagem e o canal segue de onde parou no anel.
+// Bem maior que o que o consumidor deixa acumular entre duas leituras
+// (mais de um dia a 115200 baud), para que cada recarga seja vista.
+#define UART_DMA_RX_BLOCK (1u << 30)
+
+// Origem da recarga: o DMA lê a nova contagem daqui
+static uint32_t uart_dma_rx_reload = UART_DMA_RX_BLOCK;
+
+// Total de bytes já escritos pelo DMA desde o início (módulo 2^32)
+static uint32_t uart_dma_rx_written(uart_dma_rx_t *rx)
+{
+    uint32_t remaining = dma_channel_hw_addr(rx->dma_chan)->transfer_count;
+    if (remaining > rx->last_remaining)
+        rx->block_base += UART_DMA_RX_BLOCK; // Houve recarga desde a última leitura
+    rx->last_remaining = remaining;
+    return rx->block_base + (UART_DMA_RX_BLOCK - remaining);
+}
+
+void uart_dma_rx_init(uart_dma_rx_t *rx, uart_inst_t *uart, uint8_t *ring, uint size_bits)
+{
+    rx->uart = uart;
+    rx->ring = ring;
+    rx->ring_size = 1u << size_bits;
+    rx->read_total = 0;
+    rx->overruns = 0;
+    rx->block_base = 0;
+    rx->last_remaining = UART_DMA_RX_BLOCK;
+
+    rx->dma_chan = dma_claim_unused_channel(true);
+    rx->reload_chan = dma_claim_unused_channel(true);
+
+    // Recarga: uma palavra para TRANS_COUNT do canal de dados, pelo alias
+    // que também o dispara de novo. O endereço de escrita não é tocado.
+    dma_channel_config r = dma_channel_get_default_config(rx->reload_chan);
+    channel_config_set_transfer_data_size(&r, DMA_SIZE_32);
+    channel_config_set_read_increment(&r, false);
+    channel_config_set_write_increment(&r, false);
+    dma_channel_configure(rx->reload_chan, &r, &dma_channel_hw_addr(rx->dma_chan)->al1_transfer_count_trig,
+                          &uart_dma_rx_reload, 1, false);
+
+    dma_channel_config c = dma_channel_get_default_config(rx->dma_chan);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_8);
+    channel_config_set_read_increment(&c, false);
+    channel_config_set_write_increment(&c, true);
+    channel_config_set_ring(&c, true, size_bits); // Endereço de escrita dá a volta no anel
+    channel_config_set_dreq(&c, uart_get_dreq(uart, false));
+    channel_config_set_chain_to(&c, rx->reload_chan); // Fim do bloco dispara a recarga
+    dma_channel_configure(rx->dma_chan, &c, ring, &uart_get_hw(uart)->dr, UART_DMA_RX_BLOCK, true);
+}
+
+uint32_t uart_dma_rx_available(uart_dma_rx_t *rx)
+{
+    uint32_t pending = uart_dma_rx_written(rx) - rx->read_total;
+    if (pending > rx->ring_size)
+    {
+        // O DMA deu a volta sobre dados não lidos: descarta o que foi sobrescrito
+        rx->overruns += pending - rx->ring_size;
+        rx->read_total += pending - rx->ring_size;
+        pending = rx->ring_size;
+    }
+    return pending;
+}
+
+int uart_dma_rx_getc(uart_dma_rx_t *rx)
+{
+    if (uart_dma_rx_available(rx) == 0)
+        return -1;
+    uint8_t byte = rx->ring[rx->read_total & (rx->ring_size - 1)];
+    rx->read_total++;
+    return byte;
+}
+
+void uart_dma_tx_init(uart_dma_tx_t *tx, uart_inst_t *uart)
+{
+    tx->uart = uart;
+    tx->dma_chan = dma_claim_unused_channel(true);
+    dma_channel_config c = dma_channel_get_default_config(tx->dma_chan);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_8);
+    channel_config_set_read_increment(&c, true);
+    channel_config_set_write_increment(&c, false);
+    channel_config_set_dreq(&c, uart_get_dreq(uart, true));
+    dma_channel_configure(tx->dma_chan, &c, &uart_get_hw(uart)->dr, NULL, 0, false);
+}
+
+bool uart_dma_tx_start(uart_dma_tx_t *tx, const uint8_t *buf, uint32_t len)
+{
+    if (dma_channel_is_busy(tx->dma_chan))
+        return false;
+    dma_channel_transfer_from_buffer_now(tx->dma_chan, buf, len);
+    return true;
+}
+
+bool uart_dma_tx_busy(uart_dma_tx_t *tx)
+{
+    return dma_channel_is_busy(tx->dma_chan) || (uart_get_hw(tx->uart)->fr & UART_UARTFR_BUSY_BITS);
+}
@@ -0,0 +1,87 @@
+#ifndef UART_DMA_H
+#define UART_DMA_H
+
+#include "pico/stdlib.h"
+#include "hardware/uart.h"
+
+/**
+ * @brief Recepção UART por DMA num buffer circular.
+ *
+ * O DMA escreve continuamente no anel (pacejado pelo DREQ de RX da UART),
+ * sem interrupções nem polling do periférico. O consumidor lê quando quiser;
+ * a posição de escrita vem do contador de transferências do próprio DMA.
+ * Um segundo canal, encadeado ao primeiro, recarrega a contagem ao fim de
+ * cada bloco: a recepção não para depois de 2^32 bytes.
+ */
+typedef struct
+{
+    uart_inst_t *uart;
+    int dma_chan;
+    int reload_chan;         // Reescreve a contagem do canal de dados a cada bloco
+    uint8_t *ring;           // Alinhado ao próprio tamanho (exigência do modo anel)
+    uint32_t ring_size;      // Potência de 2
+    uint32_t read_total;     // Bytes já consumidos desde o início
+    uint32_t overruns;       // Bytes perdidos por o consumidor ficar uma volta atrás
+    uint32_t block_base;     // Bytes dos blocos já recarregados
+    uint32_t last_remaining; // Contagem do canal na última leitura
+} uart_dma_rx_t;
+
+/**
+ * @brief Declara um anel de recepção com o alinhamento exigido pelo DMA.
+ */
+#define UART_DMA_RING(name, size_bits) \
+    static uint8_t name[1u << (size_bits)] __attribute__((aligned(1u << (size_bits))))
+
+/**
+ * @brief Inicia a recepção contínua por DMA.
+ *
+ * A UART já deve estar inicializada (uart_init + função dos pinos).
+ *
+ * @param ring Buffer declarado com UART_DMA_RING.
+ * @param size_bits log2 do tamanho do anel (ex.: 8 para 256 bytes).
+ */
+void uart_dma_rx_init(uart_dma_rx_t *rx, uart_inst_t *uart, uint8_t *ring, uint size_bits);
+
+/**
+ * @brief Número de bytes recebidos e ainda não lidos.
+ */
+uint32_t uart_dma_rx_available(uart_dma_rx_t *rx);
+
+/**
+ * @brief Lê um byte do anel.
+ *
+ * @return Byte lido ou -1 se não há dados.
+ */
+int uart_dma_rx_getc(uart_dma_rx_t *rx);
+
+/**
+ * @brief Transmissão UART por DMA a partir de um buffer do chamador.
+ *
+ * O DMA alimenta a FIFO de TX pacejado pelo DREQ; a CPU só dispara o envio.
+ * O buffer não pode ser alterado enquanto uart_dma_tx_busy() for true.
+ */
+typedef struct
+{
+    uart_inst_t *uart;
+    int dma_chan;
+} uart_dma_tx_t;
+
+/**
+ * @brief Reserva o canal de DMA de transmissão (UART já inicializada).
+ */
+void uart_dma_tx_init(uart_dma_tx_t *tx, uart_inst_t *uart);
+
+/**
+ * @brief Inicia o envio de 'len' bytes.
+ *
+ * @return false se um envio anterior ainda está em andamento.
+ */
+bool uart_dma_tx_start(uart_dma_tx_t *tx, const uint8_t *buf, uint32_t len);
+
+/**
+ * @brief true enquanto o DMA ou a UART (FIFO e registrador de deslocamento)
+ *        ainda têm bytes a enviar - em RS-485, o driver deve seguir ligado.
+ */
+bool uart_dma_tx_busy(uart_dma_tx_t *tx);
+
+#endif // UART_DMA_H
@@ -0,0 +1,129 @@
+#include "ui.h"
+#include "fmt.h"
+#include <string.h>
+
+// Largura de um caractere da fonte 8x8
+#define UI_CHAR_WIDTH 8
+
+void ui_field_init(ui_field_t *field, const char *label, uint8_t x, uint8_t page,
+                   uint8_t width, uint8_t digits, const font_t *font, uint16_t deadband)
+{
+    field->label = label;
+    field->x = x;
+    field->page = page;
+    field->width = width;
+    field->pages = font ? font->pages : 1;
+    field->digits = digits;
+    field->decimals = 0;
+    field->font = font;
+    field->deadband = deadband;
+    field->value = 0;
+    field->valid = false;
+}
+
+bool ui_field_set(ssd1306_t *ssd, ui_field_t *field, int32_t value)
+{
+    if (field->valid)
+    {
+        if (value == UI_FIELD_NONE || field->value == UI_FIELD_NONE)
+        {
+            if (value == field->value)
+                return false;
+        }
+        else
+        {
+            int32_t delta = value - field->value;
+            if (delta < 0)
+                delta = -delta;
+            if (delta <= field->deadband)
+                return false; // Dentro da zona morta: nenhum tráfego no barramento
+        }
+    }
+
+    // Rótulo + número desenhados direto no buffer, sem string intermediária
+    uint8_t y = field->page * 8;
+    uint8_t x = field->x + strlen(field->label) * UI_CHAR_WIDTH;
+    ssd1306_fill_region(ssd, field->x, field->page, field->width, field->pages, false);
+    ssd1306_draw_string(ssd, field->label, field->x, y);
+    if (value == UI_FIELD_NONE)
+        ssd1306_draw_string(ssd, "--", field->x + field->width - 2 * UI_CHAR_WIDTH, y);
+    else if (field->font)
+        font_draw_int(ssd, field->font, field->x + field->width, y, value);
+    else if (field->decimals)
+        fmt_draw_fixed(ssd, x, y, value, field->decimals, field->digits);
+    else
+        fmt_draw_int(ssd, x, y, value, field->digits);
+    ssd1306_send_region(ssd, field->x, field->page, field->width, field->pages);
+
+    field->value = value;
+    field->valid = true;
+    return true;
+}
+
+void ui_label_init(ui_label_t *label, uint8_t page, uint8_t pages, const font_t *font)
+{
+    label->page = page;
+    label->pages = pages;
+    label->font = font;
+    label->text = NULL;
+    label->valid = false;
+}
+
+bool ui_label_set(ssd1306_t *ssd, ui_label_t *label, const char *text)
+{
+    // Os textos são literais: comparar ponteiros basta para detectar mudança
+    if (label->valid && label->text == text)
+        return false;
+
+    ssd1306_fill_region(ssd, 0, label->page, ssd->width, label->pages, false);
+    if (text != NULL)
+    {
+        size_t text_width = label->font ? font_text_width(label->font, text) : strlen(text) * UI_CHAR_WIDTH;
+        uint8_t x = text_width < ssd->width ? (ssd->width - text_width) / 2 : 0;
+        if (label->font)
+            font_draw_string(ssd, label->font, text, x, label->page * 8);
+        else
+            ssd1306_draw_string(ssd, text, x, label->page * 8);
+    }
+    ssd1306_send_region(ssd, 0, label->page, ssd->width, label->pages);
+
+    label->text = text;
+    label->valid = true;
+    return true;
+}
+
+void ui_icon_init(ui_icon_t *icon, uint8_t x, uint8_t page, uint8_t width, uint8_t pages)
+{
+    icon->x = x;
+    icon->page = page;
+    icon->width = width;
+    icon->pages = pages;
+    icon->asset = NULL;
+    icon->valid = false;
+}
+
+bool ui_icon_set(ssd1306_t *ssd, ui_icon_t *icon, const asset_t *asset)
+{
+    if (icon->valid && icon->asset == asset)
+        return false;
+
+    ssd1306_fill_region(ssd, icon->x, icon->page, icon->width, icon->pages, false);
+    if (asset != NULL)
+    {
+        // Centralizado no retângulo (o asset deve caber nele)
+        int16_t x = icon->x + ((int16_t)icon->width - asset->width) / 2;
+        uint8_t page = asset->pages < icon->pages ? icon->page + (icon->pages - asset->pages) / 2 : icon->page;
+        asset_draw(ssd, asset, x, page * 8);
+    }
+    ssd1306_send_region(ssd, icon->x, icon->page, icon->width, icon->pages);
+
+    icon->asset = asset;
+    icon->valid = true;
+    return true;
+}
+
+void ui_clear(ssd1306_t *ssd)
+{
+    ssd1306_fill(ssd, false);
+    ssd1306_send_data(ssd);
+}
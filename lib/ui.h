@@ -0,0 +1,118 @@
+#ifndef UI_H
+#define UI_H
+
+#include "pico/stdlib.h"
+#include "ssd1306.h"
+#include "fonts.h"
+#include "assets.h"
+
+/**
+ * @brief Campo numérico retido: guarda o último valor desenhado e só
+ * redesenha (e envia) o próprio retângulo quando o valor sai da zona morta.
+ */
+typedef struct
+{
+    const char *label; // Prefixo fixo, ex.: "R: "
+    uint8_t x;         // Coluna inicial (pixels)
+    uint8_t page;      // Página inicial (linhas de 8 pixels)
+    uint8_t width;     // Largura do retângulo (pixels)
+    uint8_t pages;     // Altura do retângulo (páginas)
+    uint8_t digits;    // Largura do número (alinhado à direita)
+    uint8_t decimals;  // Casas decimais do valor em ponto fixo (0 = inteiro)
+    const font_t *font; // Fonte do número (NULL = 8x8 monoespaçada)
+    uint16_t deadband; // Variação mínima (exclusiva) para redesenhar
+    int32_t value;     // Último valor desenhado
+    bool valid;        // false força o próximo redesenho
+} ui_field_t;
+
+/**
+ * @brief Rótulo de texto retido (títulos, faixas de alerta).
+ *
+ * O texto é centralizado no retângulo e só é redesenhado quando muda.
+ */
+typedef struct
+{
+    uint8_t page;     // Página inicial
+    uint8_t pages;    // Altura do retângulo (páginas)
+    const font_t *font; // Fonte do texto (NULL = 8x8 monoespaçada)
+    const char *text; // Último texto desenhado (NULL = vazio)
+    bool valid;       // false força o próximo redesenho
+} ui_label_t;
+
+/**
+ * @brief Ícone retido: um asset centralizado num retângulo, redesenhado
+ * só quando o asset muda.
+ */
+typedef struct
+{
+    uint8_t x;             // Coluna inicial (pixels)
+    uint8_t page;          // Página inicial
+    uint8_t width;         // Largura do retângulo (pixels)
+    uint8_t pages;         // Altura do retângulo (páginas)
+    const asset_t *asset;  // Último asset desenhado (NULL = vazio)
+    bool valid;            // false força o próximo redesenho
+} ui_icon_t;
+
+/**
+ * @brief Inicializa um campo numérico. O primeiro ui_field_set sempre desenha.
+ *
+ * Com 'font' != NULL o número é desenhado nessa fonte, alinhado à direita do
+ * retângulo, que passa a ter a altura da fonte; 'digits' é ignorado.
+ */
+void ui_field_init(ui_field_t *field, const char *label, uint8_t x, uint8_t page,
+                   uint8_t width, uint8_t digits, const font_t *font, uint16_t deadband);
+
+// Valor de campo sem dados (sensor ausente): desenhado como "--"
+#define UI_FIELD_NONE INT32_MIN
+
+/**
+ * @brief Atualiza o valor do campo (UI_FIELD_NONE = sem dados).
+ *
+ * @return true se o campo foi redesenhado e enviado ao display.
+ */
+bool ui_field_set(ssd1306_t *ssd, ui_field_t *field, int32_t value);
+
+/**
+ * @brief Inicializa um rótulo que ocupa a largura inteira do display.
+ *
+ * @param font Fonte do texto (NULL = 8x8 monoespaçada, que quebra linha).
+ */
+void ui_label_init(ui_label_t *label, uint8_t page, uint8_t pages, const font_t *font);
+
+/**
+ * @brief Define o texto do rótulo (NULL apaga).
+ *
+ * @return true se o rótulo foi redesenhado e enviado ao display.
+ */
+bool ui_label_set(ssd1306_t *ssd, ui_label_t *label, const char *text);
+
+/**
+ * @brief Inicializa um ícone no retângulo dado.
+ */
+void ui_icon_init(ui_icon_t *icon, uint8_t x, uint8_t page, uint8_t width, uint8_t pages);
+
+/**
+ * @brief Define o asset do ícone (NULL apaga).
+ *
+ * @return true se o ícone foi redesenhado e enviado ao display.
+ */
+bool ui_icon_set(ssd1306_t *ssd, ui_icon_t *icon, const asset_t *asset);
+
+/**
+ * @brief Limpa o display inteiro (troca de tela). Os widgets da nova tela
+ * devem ser invalidados para redesenharem na próxima atualização.
+ */
+void ui_clear(ssd1306_t *ssd);
+
+/**
+ * @brief Exibe o valor do campo em ponto fixo: 123 com 1 casa -> "12.3".
+ *
+ * Só vale para a fonte 8x8 ('font' == NULL); 'digits' inclui o ponto.
+ */
+static inline void ui_field_set_decimals(ui_field_t *field, uint8_t decimals) { field->decimals = decimals; }
+
+static inline void ui_field_invalidate(ui_field_t *field) { field->valid = false; }
+static inline void ui_label_invalidate(ui_label_t *label) { label->valid = false; }
+static inline void ui_icon_invalidate(ui_icon_t *icon) { icon->valid = false; }
+
+#endif // UI_H
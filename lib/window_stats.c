@@ -0,0 +1,219 @@
+#include "window_stats.h"
+
+static const struct
+{
+    uint32_t bucket_ms;
+    uint8_t nbuckets;
+} ws_layout[WS_SPANS] = {
+    [WS_1S] = {100, 10},
+    [WS_10S] = {1000, 10},
+    [WS_60S] = {5000, 12},
+};
+
+// --- Fila circular de ids (capacidade WS_MAX_BUCKETS) ---
+
+static inline uint32_t dq_front(const ws_deque_t *dq)
+{
+    return dq->ids[dq->head];
+}
+
+static inline uint32_t dq_back(const ws_deque_t *dq)
+{
+    return dq->ids[(dq->head + dq->len - 1) % WS_MAX_BUCKETS];
+}
+
+static inline void dq_pop_front(ws_deque_t *dq)
+{
+    dq->head = (dq->head + 1) % WS_MAX_BUCKETS;
+    dq->len--;
+}
+
+static inline void dq_pop_back(ws_deque_t *dq)
+{
+    dq->len--;
+}
+
+static inline void dq_push_back(ws_deque_t *dq, uint32_t id)
+{
+    dq->ids[(dq->head + dq->len) % WS_MAX_BUCKETS] = id;
+    dq->len++;
+}
+
+// --- Janela ---
+
+static inline ws_bucket_t *ws_bucket(ws_window_t *w, uint32_t id)
+{
+    return &w->buckets[id % w->nbuckets];
+}
+
+static void ws_window_clear(ws_window_t *w)
+{
+    w->started = false;
+    w->sum = 0;
+    w->sumsq = 0;
+    w->count = 0;
+    w->min_dq.head = w->min_dq.len = 0;
+    w->max_dq.head = w->max_dq.len = 0;
+    for (uint8_t i = 0; i < w->nbuckets; i++)
+        w->buckets[i] = (ws_bucket_t){0};
+}
+
+// Fecha o balde corrente: passa a competir nas filas de mínimo e máximo
+static void ws_close_bucket(ws_window_t *w)
+{
+    const ws_bucket_t *b = ws_bucket(w, w->cur_id);
+    if (b->count == 0)
+        return;
+
+    while (w->min_dq.len && ws_bucket(w, dq_back(&w->min_dq))->min >= b->min)
+        dq_pop_back(&w->min_dq);
+    dq_push_back(&w->min_dq, w->cur_id);
+
+    while (w->max_dq.len && ws_bucket(w, dq_back(&w->max_dq))->max <= b->max)
+        dq_pop_back(&w->max_dq);
+    dq_push_back(&w->max_dq, w->cur_id);
+}
+
+// Abre o balde seguinte, reaproveitando a posição do que sai da janela
+static void ws_open_next(ws_window_t *w)
+{
+    w->cur_id++;
+    uint32_t expired = w->cur_id - w->nbuckets;
+    ws_bucket_t *b = ws_bucket(w, w->cur_id);
+
+    w->sum -= b->sum;
+    w->sumsq -= b->sumsq;
+    w->count -= b->count;
+    b->count = 0;
+    b->sum = 0;
+    b->sumsq = 0;
+
+    if (w->min_dq.len && dq_front(&w->min_dq) == expired)
+        dq_pop_front(&w->min_dq);
+    if (w->max_dq.len && dq_front(&w->max_dq) == expired)
+        dq_pop_front(&w->max_dq);
+}
+
+static void ws_window_add(ws_window_t *w, uint32_t t_ms, int32_t value)
+{
+    uint32_t id = t_ms / w->bucket_ms;
+
+    if (w->started && id - w->cur_id >= w->nbuckets)
+        ws_window_clear(w); // Lacuna maior que a janela: nada do passado vale
+    if (!w->started)
+    {
+        w->started = true;
+        w->cur_id = id;
+    }
+    else
+    {
+        // No máximo nbuckets - 1 passos, pela verificação acima
+        while (w->cur_id != id)
+        {
+            ws_close_bucket(w);
+            ws_open_next(w);
+        }
+    }
+
+    ws_bucket_t *b = ws_bucket(w, id);
+    if (b->count == 0)
+    {
+        b->min = value;
+        b->max = value;
+    }
+    else
+    {
+        if (value < b->min)
+            b->min = value;
+        if (value > b->max)
+            b->max = value;
+    }
+    b->count++;
+    b->sum += value;
+    b->sumsq += (int64_t)value * value;
+
+    w->count++;
+    w->sum += value;
+    w->sumsq += (int64_t)value * value;
+}
+
+// Raiz quadrada inteira (bit a bit, 32 iterações no pior caso)
+static uint32_t ws_isqrt(uint64_t x)
+{
+    uint64_t res = 0;
+    uint64_t bit = (uint64_t)1 << 62;
+    while (bit > x)
+        bit >>= 2;
+    while (bit)
+    {
+        if (x >= res + bit)
+        {
+            x -= res + bit;
+            res = (res >> 1) + bit;
+        }
+        else
+        {
+            res >>= 1;
+        }
+        bit >>= 2;
+    }
+    return (uint32_t)res;
+}
+
+void window_stats_init(window_stats_t *ws)
+{
+    for (int s = 0; s < WS_SPANS; s++)
+    {
+        ws->win[s].bucket_ms = ws_layout[s].bucket_ms;
+        ws->win[s].nbuckets = ws_layout[s].nbuckets;
+    }
+    window_stats_reset(ws);
+}
+
+void window_stats_reset(window_stats_t *ws)
+{
+    for (int s = 0; s < WS_SPANS; s++)
+        ws_window_clear(&ws->win[s]);
+}
+
+void window_stats_add(window_stats_t *ws, uint32_t t_ms, int32_t value)
+{
+    for (int s = 0; s < WS_SPANS; s++)
+        ws_window_add(&ws->win[s], t_ms, value);
+}
+
+bool window_stats_get(const window_stats_t *ws, ws_span_t span, ws_result_t *out)
+{
+    const ws_window_t *w = &ws->win[span];
+    if (w->count == 0)
+        return false;
+
+    // Baldes fechados pela frente das filas; o corrente entra à parte
+    const ws_bucket_t *cur = &w->buckets[w->cur_id % w->nbuckets];
+    bool have_cur = cur->count > 0;
+    int32_t min = have_cur ? cur->min : INT32_MAX;
+    int32_t max = have_cur ? cur->max : INT32_MIN;
+    if (w->min_dq.len)
+    {
+        int32_t m = w->buckets[dq_front(&w->min_dq) % w->nbuckets].min;
+        if (m < min)
+            min = m;
+    }
+    if (w->max_dq.len)
+    {
+        int32_t m = w->buckets[dq_front(&w->max_dq) % w->nbuckets].max;
+        if (m > max)
+            max = m;
+    }
+
+    // Variância = (n * soma2 - soma^2) / n^2, tudo em inteiros
+    int64_t n = w->count;
+    int64_t spread = n * w->sumsq - w->sum * w->sum;
+    out->count = w->count;
+    out->min = min;
+    out->max = max;
+    out->mean = w->sum / n;
+    out->stddev = spread > 0 ? ws_isqrt(spread) / n : 0;
+    out->stddev_x10 = spread > 0 ? ws_isqrt((uint64_t)spread * 100) / n : 0;
+    return true;
+}
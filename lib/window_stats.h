@@ -0,0 +1,97 @@
+#ifndef WINDOW_STATS_H
+#define WINDOW_STATS_H
+
+#include "pico/stdlib.h"
+
+/**
+ * @brief Estatísticas em janelas deslizantes de tempo (1 s, 10 s, 60 s).
+ *
+ * Cada janela é dividida em baldes de duração fixa. A amostra atualiza o
+ * balde corrente de cada janela; quando um balde fecha, o mais antigo sai
+ * das somas correntes (média e variância em inteiros) e das filas
+ * monotônicas de mínimo e máximo. Inserção e consulta custam O(1),
+ * independentemente de quantas amostras a janela contém.
+ *
+ * A janela cobre entre (n - 1) e n baldes: a borda antiga avança um balde
+ * por vez.
+ */
+
+#define WS_MAX_BUCKETS 12
+
+typedef enum
+{
+    WS_1S,
+    WS_10S,
+    WS_60S,
+    WS_SPANS
+} ws_span_t;
+
+typedef struct
+{
+    int32_t min;
+    int32_t max;
+    int32_t sum;
+    int64_t sumsq;
+    uint16_t count;
+} ws_bucket_t;
+
+// Fila monotônica de ids de baldes fechados
+typedef struct
+{
+    uint32_t ids[WS_MAX_BUCKETS];
+    uint8_t head;
+    uint8_t len;
+} ws_deque_t;
+
+typedef struct
+{
+    uint32_t bucket_ms;
+    uint8_t nbuckets;
+    bool started;
+    uint32_t cur_id; // Número absoluto do balde corrente (t / bucket_ms)
+    ws_bucket_t buckets[WS_MAX_BUCKETS];
+    int64_t sum;
+    int64_t sumsq;
+    uint32_t count;
+    ws_deque_t min_dq; // Mínimos crescentes: a frente é o menor
+    ws_deque_t max_dq; // Máximos decrescentes: a frente é o maior
+} ws_window_t;
+
+typedef struct
+{
+    ws_window_t win[WS_SPANS];
+} window_stats_t;
+
+typedef struct
+{
+    uint32_t count;
+    int32_t min;
+    int32_t max;
+    int32_t mean;
+    uint32_t stddev;
+    uint32_t stddev_x10; // Desvio em décimos, para exibir com uma casa decimal
+} ws_result_t;
+
+/**
+ * @brief Configura as janelas de 1 s (10 x 100 ms), 10 s (10 x 1 s) e 60 s (12 x 5 s).
+ */
+void window_stats_init(window_stats_t *ws);
+
+/**
+ * @brief Esvazia todas as janelas.
+ */
+void window_stats_reset(window_stats_t *ws);
+
+/**
+ * @brief Inclui uma amostra no instante t_ms (não decrescente entre chamadas).
+ */
+void window_stats_add(window_stats_t *ws, uint32_t t_ms, int32_t value);
+
+/**
+ * @brief Lê mínimo, máximo, média e desvio padrão da janela.
+ *
+ * @return false se a janela está vazia.
+ */
+bool window_stats_get(const window_stats_t *ws, ws_span_t span, ws_result_t *out);
+
+#endif // WINDOW_STATS_H
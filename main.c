@@ -1,7 +1,11 @@
 #include <stdio.h>
 #include "pico/stdlib.h"
 #include "pico/bootrom.h"
+#include "pico/multicore.h"
 #include "hardware/gpio.h"
+#include "hardware/i2c.h"
+#include "hardware/uart.h"
+#include "hardware/spi.h"
 
 // Bibliotecas do projeto
 #include "ssd1306.h"
@@ -12,6 +16,23 @@
 #include "leds.h"
 #include "buzzer.h"
 #include "matrizRGB.h"
+#include "clock_governor.h"
+#include "boot_profile.h"
+#include "ui.h"
+#include "filter.h"
+#include "adaptive_rate.h"
+#include "trigger.h"
+#include "headless.h"
+#include "acquisition.h"
+#include "interp_kernels.h"
+#include "ambient_comp.h"
+#include "window_stats.h"
+#include "spc.h"
+#include "app_fsm.h"
+#include "assets.h"
+#include "i2c_target.h"
+#include "rs485.h"
+#include "supervisor.h"
 
 // --- Pinos ---
 #define BUZZER_PIN 21
@@ -21,183 +42,1151 @@
 #define I2C_SDA_DISP 14
 #define I2C_SCL_DISP 15
 #define DISPLAY_ADDRESS 0x3C
+#define I2C_BAUD_DISP (400 * 1000)
+
+// --- Display por SPI (alternativa ao I2C, escolhida na inicialização) ---
+// 1: SSD1306 em SPI com DMA (~1 ms por quadro); 0: I2C a 400 kHz (~25 ms)
+#define DISPLAY_USE_SPI 0
+#define SPI_PORT_DISP spi0
+#define SPI_SCK_DISP 18
+#define SPI_MOSI_DISP 19
+#define SPI_CS_DISP 17
+#define SPI_DC_DISP 20
+#define SPI_RST_DISP 16
+#define SPI_BAUD_DISP (10 * 1000 * 1000)
+
+// --- Modo alvo I2C: estação lida por um controlador agregador ---
+// Usa o i2c1, livre só com o display em SPI (GP2 = SDA1, GP3 = SCL1)
+#define I2C_TARGET_ENABLE 0
+#define I2C_TARGET_PORT i2c1
+#define I2C_TARGET_SDA 2
+#define I2C_TARGET_SCL 3
+#define I2C_TARGET_ADDR 0x42
+#define I2C_TARGET_BAUD (400 * 1000)
+
+#if I2C_TARGET_ENABLE && !DISPLAY_USE_SPI
+#error "I2C_TARGET_ENABLE requer DISPLAY_USE_SPI: o i2c1 é do display"
+#endif
+
+// --- GY-33 pela UART do processador do módulo (alternativa ao I2C) ---
+#define GY33_USE_UART 0
+#define UART_PORT_GY33 uart1
+#define UART_TX_GY33 8
+#define UART_RX_GY33 9
+
+// --- Nó do barramento RS-485 de coleta (transceptor em GP8/9, DE em GP10) ---
+// Usa a uart1: exclusivo com o GY-33 em UART
+#define RS485_ENABLE 0
+#define RS485_UART uart1
+#define RS485_TX 8
+#define RS485_RX 9
+#define RS485_DE 10
+#define RS485_BAUD 460800
+#define RS485_NODE_ADDR 1
+
+#if RS485_ENABLE && GY33_USE_UART
+#error "RS485_ENABLE e GY33_USE_UART disputam a uart1"
+#endif
+
+// --- Captura disparada (barreira óptica da esteira); requer o GY-33 em I2C ---
+#define TRIGGER_PIN 4
+#define TRIGGER_EDGE GPIO_IRQ_EDGE_FALL
+#define TRIGGER_DELAY_US 0 // Atraso entre a borda e o início da integração
 
 // I2C para o sensor BH1750
 #define I2C_PORT_BH1750 i2c0
 #define I2C_SDA_BH1750 0
 #define I2C_SCL_BH1750 1
+#define I2C_BAUD_BH1750 (100 * 1000)
 
-// --- Estados da Aplicação ---
+// --- Estados da Aplicação (tabela app_states; transições em app_transitions) ---
 typedef enum
 {
     STATE_CALIBRATE_WHITE,
     STATE_CALIBRATE_BLACK,
-    STATE_RUNNING
+    STATE_RUNNING,
+    STATE_TRIGGERED, // Uma captura por borda no TRIGGER_PIN (botão C alterna)
+    STATE_HEADLESS,  // Vazão máxima pela USB, sem display/matriz/buzzer
+    STATE_COUNT
 } AppState;
 
-AppState current_state = STATE_CALIBRATE_WHITE;
+// --- Eventos: postados por IRQs, timers, alertas e console; tratados no loop ---
+typedef enum
+{
+    EV_BTN_A,
+    EV_BTN_C,
+    EV_RECALIBRATE, // Console ou alvo I2C: volta à calibração de branco
+    EV_RELEARN,     // Alvo I2C: cor atual vira o alvo das cartas de controle
+    EV_STATS_TIMER, // Período da telemetria STAT
+    EV_ALERT        // arg = bits ALERT_*
+} AppEvent;
+
+#define ALERT_RED (1u << 0)       // Vermelho intenso
+#define ALERT_LOW_LIGHT (1u << 1) // Luminosidade baixa
+#define ALERT_DRIFT (1u << 2)     // Deriva nova; canais em (arg >> 8) & 0x07
+
+#define EVENT_QUEUE_LEN 16
+
+// --- Subsistemas: cada estado declara quais rodam ---
+#define SUB_ACQ (1u << 0)       // Aquisição por timer (i2c0 na IRQ)
+#define SUB_TRIGGER (1u << 1)   // Captura disparada no TRIGGER_PIN
+#define SUB_HEADLESS (1u << 2)  // Fluxo contínuo pela USB
+#define SUB_OUTPUTS (1u << 3)   // LEDs, matriz e buzzer
+#define SUB_TELEMETRY (1u << 4) // Linhas STAT periódicas
+
+static app_fsm_t app;
+
+// Display compartilhado entre o boot no núcleo 1 e o loop principal
+static ssd1306_t ssd;
+
+// --- Tela retida ---
+typedef enum
+{
+    SCREEN_NONE,
+    SCREEN_CAL,
+    SCREEN_NORMAL,
+    SCREEN_ALERT
+} ScreenMode;
+
+static ScreenMode screen_mode = SCREEN_NONE;
+
+// Zonas mortas: variações menores ou iguais não geram tráfego no display
+#define UI_DEADBAND_RGB 2
+#define UI_DEADBAND_LUX 3
+
+// --- Filtros por canal, aplicados a cada amostra antes do display e dos alertas ---
+#define FILTER_RGB_TYPE FILTER_MEDIAN // Mediana de 5: elimina picos isolados
+#define FILTER_RGB_PARAM 5
+#define FILTER_LUX_TYPE FILTER_EMA // EMA com alfa = 1/4
+#define FILTER_LUX_PARAM 2
+
+static filter_t filter_r, filter_g, filter_b, filter_lux;
+
+// --- Correção de cor: 1 = tabela 3D inteira (lib/color_lut_data.c), 0 = CCM em float ---
+#define COLOR_USE_LUT 1
+
+// --- Compensação da luz ambiente: ganho segue o lux do BH1750 desde a calibração ---
+#define AMB_GAIN_SHIFT 3 // Ganho converge com alfa = 1/8 por amostra
+
+static ambient_comp_t ambient;
+
+// --- Estatísticas deslizantes (1 s / 10 s / 60 s) de R, G, B e lux ---
+#define STATS_SCREEN_SPAN WS_10S   // Desvio padrão mostrado ao lado de cada canal
+#define STATS_TELEMETRY_MS 1000    // Período das linhas "STAT" no stdio
+
+static window_stats_t stats_r, stats_g, stats_b, stats_lux;
+static repeating_timer_t stats_timer;
+
+// --- Controle estatístico de processo: deriva lenta de R, G e B ---
+#define SPC_CUSUM_K 3        // Folga do CUSUM (contagens): detecta derivas a partir de ~6
+#define SPC_CUSUM_H 40       // Limiar de decisão do CUSUM
+#define SPC_EWMA_SHIFT 4     // EWMA com lambda = 1/16
+#define SPC_EWMA_LIMIT 8     // Afastamento máximo da EWMA em relação ao alvo
+#define SPC_LEARN_SAMPLES 32 // Alvo = média das primeiras amostras (botão A reaprende)
+
+static spc_chart_t spc_r, spc_g, spc_b;
+static bool spc_relearn = false;
+static uint8_t spc_drift = 0; // Máscara de canais em deriva (bit 0 = R, 1 = G, 2 = B)
+
+// Rótulos de deriva indexados pela máscara de canais (bit 0 = R, 1 = G, 2 = B)
+static const char *const drift_labels[8] = {
+    NULL, "Canal R", "Canal G", "Canais R G",
+    "Canal B", "Canais R B", "Canais G B", "Canais R G B"};
+
+// --- Aquisição por timer; o período é escolhido pelo controlador adaptativo ---
+#define ACQ_MIN_PERIOD_MS 40  // > integração do GY-33 (ATIME 0xF5 = 26.4 ms)
+#define ACQ_MAX_PERIOD_MS 800
+#define LOOP_IDLE_MS 20       // Maior espera entre voltas (botões e telas seguem responsivos)
+
+static adaptive_rate_t acq_rate;
+
+// Limiar do alerta de luz baixa (configurável pelo alvo I2C)
+#define LUX_LOW_DEFAULT 20
+
+static uint16_t lux_low = LUX_LOW_DEFAULT;
+
+static ui_field_t field_r, field_g, field_b, field_lux;
+static ui_field_t field_r_sd, field_g_sd, field_b_sd;
+static ui_label_t label_title, label_line1, label_line2;
+static ui_icon_t icon_status, icon_unit;
+
+// 1: mede os kernels do interpolador contra a versão em C após o boot
+#define BENCH_KERNELS 0
+
+// Sinal enviado pelo núcleo 1 ao terminar a inicialização do display
+#define BOOT_CORE1_DONE 0xB007D0E
+// Sinal do núcleo 0 para o núcleo 1 assumir o supervisor (tarefas registradas)
+#define BOOT_SUPERVISOR_START 0x5AFE
+
+// --- Supervisor: prazo entre check-ins de cada tarefa (watchdog no núcleo 1) ---
+// O loop fica até ~1.2 s num toque de alerta (toque_1) seguido de uma leitura do BH1750
+#define SUP_DEADLINE_CONSOLE_MS 2000
+#define SUP_DEADLINE_DISPLAY_MS 2000
+#define SUP_DEADLINE_MATRIX_MS 2000
+#define SUP_DEADLINE_SENSOR_MS 2000 // > ACQ_MAX_PERIOD_MS: amostras chegam do timer
+
+static sup_task_t task_sensor, task_display, task_matrix, task_console;
 
 // --- Protótipos das Funções de Desenho ---
-void draw_cal_screen(ssd1306_t *ssd, const char *line1, const char *line2);
-void draw_combined_screen(ssd1306_t *ssd, uint8_t r, uint8_t g, uint8_t b, uint16_t lux);
+void draw_cal_screen(ssd1306_t *ssd, const asset_t *icon, const char *line1, const char *line2);
+void draw_message_screen(ssd1306_t *ssd, const char *title, const asset_t *icon, const char *line1, const char *line2);
+void draw_combined_screen(ssd1306_t *ssd, uint8_t r, uint8_t g, uint8_t b, uint16_t lux, bool lux_ok, uint8_t drift);
+
+void ui_setup(void);
+bool screen_enter(ssd1306_t *ssd, ScreenMode mode);
 
 void btn_callback(uint gpio, uint32_t events);
+void on_clock_change(uint32_t sys_hz);
+void process_capture(const trigger_capture_t *cap);
+void print_stats(void);
+void core1_display_boot(void);
+void poll_console(void);
+void apply_target_config(void);
+void publish_reading(const acq_sample_t *raw, uint8_t r, uint8_t g, uint8_t b, uint16_t lux, uint8_t alerts);
+void report_presence(void);
+absolute_time_t next_wake(void);
+
+// --- Handlers de estado e ações de transição (rodam só no loop principal) ---
+static void cal_white_entry(app_fsm_t *fsm);
+static void cal_black_entry(app_fsm_t *fsm);
+static void running_entry(app_fsm_t *fsm);
+static void running_tick(app_fsm_t *fsm);
+static void triggered_entry(app_fsm_t *fsm);
+static void triggered_tick(app_fsm_t *fsm);
+static void headless_entry(app_fsm_t *fsm);
+static void headless_tick(app_fsm_t *fsm);
+static void set_subsystems(uint32_t mask, bool enable);
+
+static void act_calibrate_white(app_fsm_t *fsm, const app_event_t *ev);
+static void act_calibrate_black(app_fsm_t *fsm, const app_event_t *ev);
+static void act_relearn(app_fsm_t *fsm, const app_event_t *ev);
+static void act_print_stats(app_fsm_t *fsm, const app_event_t *ev);
+static void act_alert(app_fsm_t *fsm, const app_event_t *ev);
+
+// Calibração não adquire nem atualiza a matriz: o i2c0 é do loop principal
+static const app_state_t app_states[STATE_COUNT] = {
+    [STATE_CALIBRATE_WHITE] = {"cal branco", 0, cal_white_entry, NULL, NULL},
+    [STATE_CALIBRATE_BLACK] = {"cal preto", 0, cal_black_entry, NULL, NULL},
+    [STATE_RUNNING] = {"continuo", SUB_ACQ | SUB_OUTPUTS | SUB_TELEMETRY, running_entry, NULL, running_tick},
+    [STATE_TRIGGERED] = {"disparo", SUB_TRIGGER | SUB_OUTPUTS, triggered_entry, NULL, triggered_tick},
+    [STATE_HEADLESS] = {"headless", SUB_HEADLESS, headless_entry, NULL, headless_tick},
+};
+
+static const app_transition_t app_transitions[] = {
+    {STATE_CALIBRATE_WHITE, EV_BTN_A, STATE_CALIBRATE_BLACK, act_calibrate_white},
+    {STATE_CALIBRATE_BLACK, EV_BTN_A, STATE_RUNNING, act_calibrate_black},
+    // A cor atual passa a ser o alvo das cartas de controle
+    {STATE_RUNNING, EV_BTN_A, APP_FSM_STAY, act_relearn},
+    {STATE_RUNNING, EV_RELEARN, APP_FSM_STAY, act_relearn},
+#if !GY33_USE_UART
+    // Botão C alterna: leitura contínua -> captura disparada -> headless
+    {STATE_RUNNING, EV_BTN_C, STATE_TRIGGERED, NULL},
+    {STATE_TRIGGERED, EV_BTN_C, STATE_HEADLESS, NULL},
+    {STATE_HEADLESS, EV_BTN_C, STATE_RUNNING, NULL},
+#endif
+    {APP_FSM_ANY, EV_RECALIBRATE, STATE_CALIBRATE_WHITE, NULL},
+    {STATE_RUNNING, EV_STATS_TIMER, APP_FSM_STAY, act_print_stats},
+    {APP_FSM_ANY, EV_ALERT, APP_FSM_STAY, act_alert},
+};
 
 int main()
 {
+    boot_profile_start();
+    // Antes de qualquer trace: o registro do reset anterior está na RAM não inicializada
+    supervisor_init();
+    boot_phase_begin("stdio");
     stdio_init_all();
-    sleep_ms(2000);
+    boot_phase_end();
+
+    // O display (i2c1) sobe no núcleo 1 em paralelo com os periféricos do núcleo 0
+    multicore_launch_core1(core1_display_boot);
+
+    // Fila de eventos pronta antes da primeira IRQ de botão
+    app_fsm_init(&app, app_states, STATE_COUNT, app_transitions,
+                 count_of(app_transitions), STATE_CALIBRATE_WHITE, EVENT_QUEUE_LEN, set_subsystems);
 
     // Inicializa periféricos
+    boot_phase_begin("botoes/leds");
     buttons_init(btn_callback);
     led_init();
+    boot_phase_end();
+
+    boot_phase_begin("gy33");
+#if GY33_USE_UART
+    gy33_init_uart(UART_PORT_GY33, UART_TX_GY33, UART_RX_GY33);
+#else
     gy33_init();
+#endif
+    gy33_use_lut(COLOR_USE_LUT);
+    boot_phase_end();
+
+#if !GY33_USE_UART
+    trigger_init(TRIGGER_PIN, TRIGGER_EDGE);
+    trigger_set_delay_us(TRIGGER_DELAY_US);
+#endif
+
+    boot_phase_begin("matriz");
     npInit(7);
+    boot_phase_end();
+
+    boot_phase_begin("buzzer");
     inicializar_buzzer(BUZZER_PIN);
+    boot_phase_end();
 
     // I2C para BH1750
-    i2c_init(I2C_PORT_BH1750, 100 * 1000);
+    boot_phase_begin("bh1750");
+    i2c_init(I2C_PORT_BH1750, I2C_BAUD_BH1750);
     gpio_set_function(I2C_SDA_BH1750, GPIO_FUNC_I2C);
     gpio_set_function(I2C_SCL_BH1750, GPIO_FUNC_I2C);
     gpio_pull_up(I2C_SDA_BH1750);
     gpio_pull_up(I2C_SCL_BH1750);
     bh1750_power_on(I2C_PORT_BH1750);
+    bh1750_start_continuous(I2C_PORT_BH1750);
+    if (!bh1750_is_present())
+        printf("BH1750 não encontrado: lux sem dados até ser conectado\n");
+    boot_phase_end();
 
-    // I2C e Display SSD1306
-    i2c_init(I2C_PORT_DISP, 400 * 1000);
-    gpio_set_function(I2C_SDA_DISP, GPIO_FUNC_I2C);
-    gpio_set_function(I2C_SCL_DISP, GPIO_FUNC_I2C);
-    gpio_pull_up(I2C_SDA_DISP);
-    gpio_pull_up(I2C_SCL_DISP);
-    ssd1306_t ssd;
-    ssd1306_init(&ssd, WIDTH, HEIGHT, false, DISPLAY_ADDRESS, I2C_PORT_DISP);
-    ssd1306_config(&ssd);
+    // Só espera pela USB se um host estiver conectado
+    boot_phase_begin("usb host");
+    boot_wait_usb_host();
+    boot_phase_end();
+
+    multicore_fifo_pop_blocking();
+    boot_profile_report();
+    supervisor_report_reset();
+#if BENCH_KERNELS
+    kern_benchmark();
+#endif
 
+    ui_setup();
+
+    filter_init(&filter_r, FILTER_RGB_TYPE, FILTER_RGB_PARAM);
+    filter_init(&filter_g, FILTER_RGB_TYPE, FILTER_RGB_PARAM);
+    filter_init(&filter_b, FILTER_RGB_TYPE, FILTER_RGB_PARAM);
+    filter_init(&filter_lux, FILTER_LUX_TYPE, FILTER_LUX_PARAM);
+    adaptive_rate_init(&acq_rate, ACQ_MIN_PERIOD_MS, ACQ_MAX_PERIOD_MS);
+    ambient_comp_init(&ambient, AMB_GAIN_SHIFT);
+    window_stats_init(&stats_r);
+    window_stats_init(&stats_g);
+    window_stats_init(&stats_b);
+    window_stats_init(&stats_lux);
+    spc_init(&spc_r, SPC_CUSUM_K, SPC_CUSUM_H, SPC_EWMA_SHIFT, SPC_EWMA_LIMIT);
+    spc_init(&spc_g, SPC_CUSUM_K, SPC_CUSUM_H, SPC_EWMA_SHIFT, SPC_EWMA_LIMIT);
+    spc_init(&spc_b, SPC_CUSUM_K, SPC_CUSUM_H, SPC_EWMA_SHIFT, SPC_EWMA_LIMIT);
+    acq_init(I2C_PORT_BH1750);
+
+#if I2C_TARGET_ENABLE
+    i2c_target_init(I2C_TARGET_PORT, I2C_TARGET_SDA, I2C_TARGET_SCL, I2C_TARGET_ADDR, I2C_TARGET_BAUD);
+    i2c_target_set_reg(REG_CFG_ATIME, gy33_get_atime());
+    i2c_target_set_reg(REG_CFG_LUX_LOW, lux_low & 0xFF);
+    i2c_target_set_reg(REG_CFG_LUX_LOW + 1, lux_low >> 8);
+#endif
+#if RS485_ENABLE
+    rs485_init(RS485_UART, RS485_TX, RS485_RX, RS485_DE, RS485_BAUD, RS485_NODE_ADDR);
+#endif
+
+    // Governador de clock: re-deriva I2C, PIO, PWM e UART a cada troca
+    clock_governor_register(on_clock_change);
+    clock_governor_init(CLOCK_GOV_IDLE_KHZ, CLOCK_GOV_BOOST_KHZ, CLOCK_GOV_HOLD_MS);
+
+    // Sensor só tem prazo enquanto algum subsistema adquire (set_subsystems)
+    task_sensor = supervisor_register("sensor", SUP_DEADLINE_SENSOR_MS);
+    task_display = supervisor_register("display", SUP_DEADLINE_DISPLAY_MS);
+    task_matrix = supervisor_register("matriz", SUP_DEADLINE_MATRIX_MS);
+    task_console = supervisor_register("console", SUP_DEADLINE_CONSOLE_MS);
+    supervisor_set_active(task_sensor, app_fsm_running(&app, SUB_ACQ | SUB_HEADLESS));
+    multicore_fifo_push_blocking(BOOT_SUPERVISOR_START);
+
+    uint8_t traced_state = app_fsm_current(&app);
     while (1)
     {
-        switch (current_state)
+        clock_governor_update();
+        poll_console();
+        supervisor_checkin(task_console);
+        apply_target_config();
+        report_presence();
+
+        // Eventos pendentes, transições e o tick do estado atual
+        app_fsm_dispatch(&app);
+        if (app_fsm_current(&app) != traced_state)
         {
-        case STATE_CALIBRATE_WHITE:
+            traced_state = app_fsm_current(&app);
+            supervisor_trace("estado", traced_state);
+        }
+
+        // Display e matriz: check-in quando o hardware terminou o último envio
+        if (!ssd1306_busy(&ssd))
+            supervisor_checkin(task_display);
+        if (!npBusy())
+            supervisor_checkin(task_matrix);
+
+        sleep_until(next_wake());
+    }
+}
+
+// Dorme no máximo LOOP_IDLE_MS (a aquisição segue no timer)
+absolute_time_t next_wake(void)
+{
+    absolute_time_t wake = make_timeout_time_ms(LOOP_IDLE_MS);
+#if !GY33_USE_UART
+    // Em modo disparo, acorda assim que a integração em andamento termina
+    if (app_fsm_running(&app, SUB_TRIGGER))
+    {
+        absolute_time_t trig_deadline = trigger_next_deadline();
+        if (absolute_time_diff_us(trig_deadline, wake) > 0)
+            wake = trig_deadline;
+    }
+    if (app_fsm_running(&app, SUB_HEADLESS))
+    {
+        absolute_time_t due = headless_next_due();
+        if (absolute_time_diff_us(due, wake) > 0)
+            wake = due;
+    }
+#endif
+    return wake;
+}
+
+static bool stats_timer_callback(repeating_timer_t *rt)
+{
+    (void)rt;
+    app_fsm_post(&app, EV_STATS_TIMER, 0);
+    return true;
+}
+
+// Liga/desliga subsistemas na troca de estado. O i2c0 nunca tem dois donos:
+// o subsistema antigo para antes de o novo começar.
+static void set_subsystems(uint32_t mask, bool enable)
+{
+    if (mask & (SUB_ACQ | SUB_HEADLESS))
+        supervisor_set_active(task_sensor, enable);
+
+    if (mask & SUB_ACQ)
+    {
+        if (enable)
         {
-            draw_cal_screen(&ssd, "Calibrar BRANCO", "Aperte A");
-            break;
+            // A partir daqui o i2c0 é da interrupção do timer
+            acq_reset_stats();
+            acq_start(acq_rate.period_ms * 1000);
         }
-        case STATE_CALIBRATE_BLACK:
+        else
         {
-            draw_cal_screen(&ssd, "Calibrar PRETO", "Aperte A");
-            break;
+            acq_stop();
+            acq_report();
+#if I2C_TARGET_ENABLE
+            i2c_target_report();
+#endif
+#if RS485_ENABLE
+            rs485_report();
+#endif
+            // Transações de configuração evitadas pelas sombras de registradores
+#if !GY33_USE_UART
+            reg_shadow_report(gy33_get_shadow());
+#endif
+            reg_shadow_report(bh1750_get_shadow());
+            reg_shadow_report(&ssd.window);
+#if !GY33_USE_UART
+            dev_presence_report(gy33_get_presence());
+#endif
+            dev_presence_report(bh1750_get_presence());
         }
-        case STATE_RUNNING:
+    }
+#if !GY33_USE_UART
+    // Ligar/desligar o disparo escreve no GY-33: feito aqui, nunca na IRQ do botão
+    if (mask & SUB_TRIGGER)
+    {
+        if (enable)
         {
-            // Lê ambos os sensores em cada ciclo
-            uint8_t r_final, g_final, b_final;
-            gy33_get_final_rgb(&r_final, &g_final, &b_final);
-            uint16_t lux = bh1750_read_measurement(I2C_PORT_BH1750);
-
-            // Atualiza o display com a tela combinada
-            draw_combined_screen(&ssd, r_final, g_final, b_final, lux);
-
-            // Mantém a lógica dos LEDs e alarmes
-            acender_led_rgb(r_final, g_final, b_final);
-            npFillRGB(r_final, g_final, b_final);
-
-            // Alerta para vermelho intenso
-            if (r_final > 200 && r_final > g_final * 2 && r_final > b_final * 2)
-            {
-                toque_2(BUZZER_PIN);
-            }
-
-            // Alerta para baixa luminosidade
-            if (lux < 20)
-            {
-                toque_1(BUZZER_PIN);
-            }
-            break;
+            trigger_reset_stats();
+            trigger_enable(true);
+        }
+        else
+        {
+            trigger_enable(false);
+            trigger_report();
+        }
+    }
+    if (mask & SUB_HEADLESS)
+    {
+        if (enable)
+            headless_start();
+        else
+            headless_stop();
+    }
+#endif
+    if ((mask & SUB_OUTPUTS) && !enable)
+    {
+        turn_off_leds();
+        npClear();
+        npWrite();
+        desativar_buzzer(BUZZER_PIN);
+    }
+    if (mask & SUB_TELEMETRY)
+    {
+        if (enable)
+            add_repeating_timer_ms(STATS_TELEMETRY_MS, stats_timer_callback, NULL, &stats_timer);
+        else
+            cancel_repeating_timer(&stats_timer);
+    }
+}
+
+static void cal_white_entry(app_fsm_t *fsm)
+{
+    (void)fsm;
+    draw_cal_screen(&ssd, &asset_icon_sun, "Calibrar BRANCO", "Aperte A");
+}
+
+static void cal_black_entry(app_fsm_t *fsm)
+{
+    (void)fsm;
+    draw_cal_screen(&ssd, &asset_icon_dark, "Calibrar PRETO", "Aperte A");
+}
+
+static void running_entry(app_fsm_t *fsm)
+{
+    (void)fsm;
+    // Nova calibração: o histórico dos filtros não vale mais
+    filter_reset(&filter_r);
+    filter_reset(&filter_g);
+    filter_reset(&filter_b);
+    filter_reset(&filter_lux);
+    adaptive_rate_reset(&acq_rate);
+    ambient_comp_reset(&ambient);
+    window_stats_reset(&stats_r);
+    window_stats_reset(&stats_g);
+    window_stats_reset(&stats_b);
+    window_stats_reset(&stats_lux);
+    spc_drift = 0;
+    spc_relearn = true;
+}
+
+static void running_tick(app_fsm_t *fsm)
+{
+    // Amostras chegam do timer a intervalos fixos; aqui só se consome o buffer
+    if (spc_relearn)
+    {
+        // Novo alvo: média das próximas amostras
+        spc_relearn = false;
+        spc_learn(&spc_r, SPC_LEARN_SAMPLES);
+        spc_learn(&spc_g, SPC_LEARN_SAMPLES);
+        spc_learn(&spc_b, SPC_LEARN_SAMPLES);
+    }
+
+    static uint8_t prev_valid = ACQ_VALID_COLOR | ACQ_VALID_LUX;
+    static uint16_t hold_lux = 0; // Último lux válido, para o controlador de taxa
+    acq_sample_t acq, last = {0};
+    bool fresh = false;
+    uint8_t prev_drift = spc_drift;
+    uint8_t r_final = 0, g_final = 0, b_final = 0;
+    uint16_t lux = 0;
+    while (acq_pop(&acq))
+    {
+        last = acq;
+        fresh = true;
+
+        // Sensor de volta: o histórico dos filtros é de antes da queda
+        uint8_t back = acq.valid & ~prev_valid;
+        prev_valid = acq.valid;
+        if (back & ACQ_VALID_COLOR)
+        {
+            filter_reset(&filter_r);
+            filter_reset(&filter_g);
+            filter_reset(&filter_b);
+        }
+        if (back & ACQ_VALID_LUX)
+            filter_reset(&filter_lux);
+
+        // Milissegundos desde o boot a partir do instante de 64 bits: os
+        // baldes das janelas não voltam a zero a cada 71 minutos
+        uint32_t t_ms = acq.t_us / 1000;
+        if (acq.valid & ACQ_VALID_LUX)
+        {
+            hold_lux = acq.lux;
+            window_stats_add(&stats_lux, t_ms, acq.lux);
+            lux = filter_update(&filter_lux, acq.lux);
+        }
+        // Sem o GY-33 não há cor: filtros, janelas e cartas não recebem zeros
+        if (!(acq.valid & ACQ_VALID_COLOR))
+            continue;
+
+        // Ganho de luz ambiente atualizado antes da correção de cor
+        if (acq.valid & ACQ_VALID_LUX)
+        {
+            ambient_comp_update(&ambient, acq.lux, acq.c);
+            gy33_set_ambient_gain(ambient_comp_gain(&ambient));
         }
+
+        uint8_t r_raw, g_raw, b_raw;
+        gy33_correct_rgb(acq.r, acq.g, acq.b, &r_raw, &g_raw, &b_raw);
+
+        const int32_t sample[ADAPT_CHANNELS] = {r_raw, g_raw, b_raw, hold_lux};
+        adaptive_rate_update(&acq_rate, sample);
+
+        // Janelas deslizantes sobre as amostras antes do filtro (ruído real)
+        window_stats_add(&stats_r, t_ms, r_raw);
+        window_stats_add(&stats_g, t_ms, g_raw);
+        window_stats_add(&stats_b, t_ms, b_raw);
+
+        // Cartas CUSUM/EWMA por canal, uma atualização por amostra
+        spc_drift = (spc_update(&spc_r, r_raw) ? 0x01 : 0) |
+                    (spc_update(&spc_g, g_raw) ? 0x02 : 0) |
+                    (spc_update(&spc_b, b_raw) ? 0x04 : 0);
+
+        // Estágio de filtragem: o resto do ciclo só vê valores filtrados
+        r_final = filter_update(&filter_r, r_raw);
+        g_final = filter_update(&filter_g, g_raw);
+        b_final = filter_update(&filter_b, b_raw);
+    }
+    // O controlador adaptativo escolhe o período; o timer mantém o espaçamento exato
+    acq_set_period_us(acq_rate.period_ms * 1000);
+
+    if (!fresh)
+        return;
+    // Amostras (válidas ou não) chegando: a interrupção da aquisição está viva
+    supervisor_checkin(task_sensor);
+
+    // Estado "sem dados" vem da amostra mais recente
+    static bool color_missing = false;
+    bool lux_ok = last.valid & ACQ_VALID_LUX;
+    if (!(last.valid & ACQ_VALID_COLOR))
+    {
+        draw_message_screen(&ssd, "-- SEM DADOS --", &asset_status_missing, "GY-33 ausente",
+                            lux_ok ? NULL : "BH1750 ausente");
+        if (!color_missing)
+        {
+            // Saídas não ficam mostrando a última cor válida
+            turn_off_leds();
+            npClear();
+            npWrite();
+            color_missing = true;
         }
-        // BOOTSEL pode ser checado a qualquer momento
+        publish_reading(&last, 0, 0, 0, lux, 0);
+        return;
+    }
+    color_missing = false;
+
+    // Atualiza o display com a tela combinada
+    draw_combined_screen(&ssd, r_final, g_final, b_final, lux, lux_ok, spc_drift);
+
+    // Mantém a lógica dos LEDs e alarmes
+    acender_led_rgb(r_final, g_final, b_final);
+    npFillRGB(r_final, g_final, b_final);
 
-        sleep_ms(100);
+    uint32_t alerts = 0;
+    if (r_final > 200 && r_final > g_final * 2 && r_final > b_final * 2)
+        alerts |= ALERT_RED;
+    if (lux_ok && lux < lux_low)
+        alerts |= ALERT_LOW_LIGHT;
+
+    // O controlador I2C vê a deriva enquanto ela durar
+    uint8_t flags = alerts | (spc_drift ? ALERT_DRIFT | (spc_drift << 4) : 0);
+    publish_reading(&last, r_final, g_final, b_final, lux, flags);
+
+    // Deriva: alerta só quando aparece
+    if (spc_drift && !prev_drift)
+        alerts |= ALERT_DRIFT | ((uint32_t)spc_drift << 8);
+    if (alerts)
+        app_fsm_post(fsm, EV_ALERT, alerts);
+}
+
+static void triggered_entry(app_fsm_t *fsm)
+{
+    (void)fsm;
+    draw_message_screen(&ssd, "-- DISPARO --", &asset_icon_trigger, "Aguardando peca", NULL);
+}
+
+static void triggered_tick(app_fsm_t *fsm)
+{
+    (void)fsm;
+#if !GY33_USE_UART
+    trigger_capture_t cap;
+    if (trigger_poll(&cap))
+        process_capture(&cap);
+#endif
+}
+
+static void headless_entry(app_fsm_t *fsm)
+{
+    (void)fsm;
+    // Saídas desligadas (SUB_OUTPUTS): o núcleo só adquire e transmite
+    draw_message_screen(&ssd, "-- HEADLESS --", &asset_icon_usb, "Enviando pela USB", NULL);
+    ssd1306_wait_idle(&ssd);
+}
+
+static void headless_tick(app_fsm_t *fsm)
+{
+    (void)fsm;
+#if !GY33_USE_UART
+    // Clock alto durante todo o ensaio: formatação e USB sem pausas
+    clock_governor_boost();
+    headless_poll();
+    supervisor_checkin(task_sensor);
+#endif
+}
+
+// Nos estados de calibração nenhum subsistema usa o i2c0: a leitura é do loop
+static void act_calibrate_white(app_fsm_t *fsm, const app_event_t *ev)
+{
+    (void)fsm;
+    (void)ev;
+    supervisor_trace("cal", 0);
+    gy33_calibrate_white();
+    // Iluminação de referência para a compensação de ambiente
+    uint16_t lux;
+    if (bh1750_read_latest(I2C_PORT_BH1750, &lux))
+        ambient_comp_calibrate(&ambient, lux);
+}
+
+static void act_calibrate_black(app_fsm_t *fsm, const app_event_t *ev)
+{
+    (void)fsm;
+    (void)ev;
+    supervisor_trace("cal", 1);
+    gy33_calibrate_black();
+}
+
+static void act_relearn(app_fsm_t *fsm, const app_event_t *ev)
+{
+    (void)fsm;
+    (void)ev;
+    spc_relearn = true;
+}
+
+static void act_print_stats(app_fsm_t *fsm, const app_event_t *ev)
+{
+    (void)fsm;
+    (void)ev;
+    print_stats();
+}
+
+static void act_alert(app_fsm_t *fsm, const app_event_t *ev)
+{
+    if (ev->arg & ALERT_DRIFT)
+    {
+        uint8_t d = (ev->arg >> 8) & 0x07;
+        printf("DRIFT %c%c%c\n", d & 0x01 ? 'R' : '-', d & 0x02 ? 'G' : '-', d & 0x04 ? 'B' : '-');
     }
+    // Alerta pode chegar depois da troca para um estado sem saídas
+    if (!app_fsm_running(fsm, SUB_OUTPUTS))
+        return;
+
+    // Toques bloqueiam o loop: ficam no trace caso o prazo estoure
+    supervisor_trace("toque", ev->arg);
+
+    // Alerta para vermelho intenso
+    if (ev->arg & ALERT_RED)
+        toque_2(BUZZER_PIN);
+    // Alertas de baixa luminosidade e de deriva
+    if (ev->arg & (ALERT_LOW_LIGHT | ALERT_DRIFT))
+        toque_1(BUZZER_PIN);
 }
 
-void btn_callback(uint gpio, uint32_t events)
+// Comandos de uma letra pelo stdio: a = botão A, c = botão C, r = recalibrar
+void poll_console(void)
 {
-    switch (gpio)
+    int ch;
+    while ((ch = getchar_timeout_us(0)) != PICO_ERROR_TIMEOUT)
     {
-    case BUTTON_A_PIN:
-        if (current_state == STATE_CALIBRATE_WHITE)
+        supervisor_trace("console", ch);
+        switch (ch)
         {
-            gy33_calibrate_white();
-            current_state = STATE_CALIBRATE_BLACK;
+        case 'a':
+            app_fsm_post(&app, EV_BTN_A, 0);
+            break;
+        case 'c':
+            app_fsm_post(&app, EV_BTN_C, 0);
+            break;
+        case 'r':
+            app_fsm_post(&app, EV_RECALIBRATE, 0);
+            break;
         }
-        else if (current_state == STATE_CALIBRATE_BLACK)
+    }
+}
+
+// Quedas e reconexões dos sensores. A presença muda dentro das transações
+// (às vezes na IRQ da aquisição); a mensagem sai daqui
+void report_presence(void)
+{
+    static bool gy33_was = true, bh1750_was = true;
+    bool gy33_now = gy33_is_present(), bh1750_now = bh1750_is_present();
+    if (gy33_now != gy33_was)
+    {
+        printf("GY-33 %s\n", gy33_now ? "reconectado" : "ausente");
+        supervisor_trace("gy33", gy33_now);
+    }
+    if (bh1750_now != bh1750_was)
+    {
+        printf("BH1750 %s\n", bh1750_now ? "reconectado" : "ausente");
+        supervisor_trace("bh1750", bh1750_now);
+    }
+    gy33_was = gy33_now;
+    bh1750_was = bh1750_now;
+}
+
+// Leitura mais recente para o controlador I2C (instantâneo com buffer duplo)
+// e para o coletor RS-485 (fila de registros até a confirmação)
+void publish_reading(const acq_sample_t *raw, uint8_t r, uint8_t g, uint8_t b, uint16_t lux, uint8_t alerts)
+{
+#if I2C_TARGET_ENABLE
+    const i2c_target_reading_t rd = {
+        .status = (raw->valid & ACQ_VALID_COLOR ? 0x01 : 0) | (raw->valid & ACQ_VALID_LUX ? 0x02 : 0) |
+                  (app_fsm_current(&app) << 4),
+        .alerts = alerts,
+        .t_ms = raw->t_us / 1000,
+        .r = r,
+        .g = g,
+        .b = b,
+        .lux = lux,
+        .raw_c = raw->c,
+        .raw_r = raw->r,
+        .raw_g = raw->g,
+        .raw_b = raw->b,
+    };
+    i2c_target_publish(&rd);
+#endif
+#if RS485_ENABLE
+    // O coletor só recebe cor medida; lux ausente vai como RS485_LUX_NONE
+    if (raw->valid & ACQ_VALID_COLOR)
+    {
+        const rs485_record_t rec = {
+            .t_ms = raw->t_us / 1000,
+            .r = r,
+            .g = g,
+            .b = b,
+            .alerts = alerts,
+            .lux = raw->valid & ACQ_VALID_LUX ? lux : RS485_LUX_NONE,
+            .clear = raw->c,
+        };
+        rs485_push(&rec);
+    }
+#endif
+#if !I2C_TARGET_ENABLE && !RS485_ENABLE
+    (void)raw;
+    (void)r;
+    (void)g;
+    (void)b;
+    (void)lux;
+    (void)alerts;
+#endif
+}
+
+// Configuração escrita pelo controlador I2C. Aplicada no loop, que é o dono
+// do i2c0 fora dos modos disparo e headless (esses adiam a aplicação).
+void apply_target_config(void)
+{
+#if I2C_TARGET_ENABLE
+    static uint32_t pending = 0;
+    pending |= i2c_target_take_writes();
+    if (!pending || app_fsm_running(&app, SUB_TRIGGER | SUB_HEADLESS))
+        return;
+
+    if (pending & I2C_TARGET_CFG_BIT(REG_CFG_ATIME))
+    {
+        uint8_t atime = i2c_target_get_reg(REG_CFG_ATIME);
+        // A integração tem de caber no menor período de aquisição
+        if ((256u - atime) * 2400u < ACQ_MIN_PERIOD_MS * 1000u)
         {
-            gy33_calibrate_black();
-            current_state = STATE_RUNNING;
+            bool acq = app_fsm_running(&app, SUB_ACQ);
+            if (acq)
+                acq_stop();
+            gy33_set_atime(atime);
+            if (acq)
+                acq_start(acq_rate.period_ms * 1000);
         }
+        i2c_target_set_reg(REG_CFG_ATIME, gy33_get_atime());
+    }
+    if (pending & (I2C_TARGET_CFG_BIT(REG_CFG_LUX_LOW) | I2C_TARGET_CFG_BIT(REG_CFG_LUX_LOW + 1)))
+    {
+        lux_low = i2c_target_get_reg(REG_CFG_LUX_LOW) | (i2c_target_get_reg(REG_CFG_LUX_LOW + 1) << 8);
+    }
+    if (pending & I2C_TARGET_CFG_BIT(REG_CFG_CMD))
+    {
+        uint8_t cmd = i2c_target_get_reg(REG_CFG_CMD);
+        if (cmd == I2C_TARGET_CMD_RELEARN)
+            app_fsm_post(&app, EV_RELEARN, 0);
+        else if (cmd == I2C_TARGET_CMD_RECALIBRATE)
+            app_fsm_post(&app, EV_RECALIBRATE, 0);
+        i2c_target_set_reg(REG_CFG_CMD, 0);
+    }
+    pending = 0;
+#endif
+}
+
+// Só posta eventos: estado, calibração e barramentos ficam com o loop principal
+void btn_callback(uint gpio, uint32_t events)
+{
+    (void)events;
+    switch (gpio)
+    {
+    case BUTTON_A_PIN:
+        app_fsm_post(&app, EV_BTN_A, 0);
         break;
     case BUTTON_B_PIN:
+        // BOOTSEL direto na IRQ: funciona mesmo com o loop travado
         reset_usb_boot(0, 0);
         break;
     case BUTTON_C_PIN:
-
+        app_fsm_post(&app, EV_BTN_C, 0);
         break;
     }
 }
 
-void draw_cal_screen(ssd1306_t *ssd, const char *line1, const char *line2)
+// Resultado de uma captura disparada: display, alertas e telemetria
+void process_capture(const trigger_capture_t *cap)
+{
+    // O i2c0 ainda é nosso: lê o BH1750 antes de rearmar o disparo
+    uint16_t lux = 0;
+    bool lux_ok = bh1750_read_latest(I2C_PORT_BH1750, &lux);
+    trigger_rearm();
+
+    if (lux_ok)
+    {
+        ambient_comp_update(&ambient, lux, cap->c);
+        gy33_set_ambient_gain(ambient_comp_gain(&ambient));
+    }
+
+    uint8_t r, g, b, rn, gn, bn;
+    gy33_correct_rgb(cap->r, cap->g, cap->b, &r, &g, &b);
+    // Cor normalizada: entrada das medidas de tools/build_lut.py
+    gy33_normalize_rgb(cap->r, cap->g, cap->b, &rn, &gn, &bn);
+
+    printf("TRIG %lu t=%llu us lat=%lu us C=%u R=%u G=%u B=%u n=%u,%u,%u -> %u,%u,%u lux=%u\n",
+           cap->seq, cap->trigger_us, (uint32_t)(cap->result_us - cap->trigger_us),
+           cap->c, cap->r, cap->g, cap->b, rn, gn, bn, r, g, b, lux);
+
+    draw_combined_screen(&ssd, r, g, b, lux, lux_ok, 0);
+    acender_led_rgb(r, g, b);
+    npFillRGB(r, g, b);
+
+    uint8_t alerts = 0;
+    if (r > 200 && r > g * 2 && r > b * 2)
+        alerts |= ALERT_RED;
+    if (lux_ok && lux < lux_low)
+        alerts |= ALERT_LOW_LIGHT;
+
+    const acq_sample_t raw = {
+        .t_us = cap->result_us, .c = cap->c, .r = cap->r, .g = cap->g, .b = cap->b, .lux = lux,
+        .valid = ACQ_VALID_COLOR | (lux_ok ? ACQ_VALID_LUX : 0)};
+    publish_reading(&raw, r, g, b, lux, alerts);
+
+    // Captura disparada só avisa a cor intensa (a esteira tem luz própria)
+    if (alerts & ALERT_RED)
+        app_fsm_post(&app, EV_ALERT, ALERT_RED);
+}
+
+void core1_display_boot(void)
+{
+#if DISPLAY_USE_SPI
+    // SPI e Display SSD1306 (modo 0, D/C, CS e RST controlados pelo driver)
+    boot_phase_begin("display spi");
+    spi_init(SPI_PORT_DISP, SPI_BAUD_DISP);
+    gpio_set_function(SPI_SCK_DISP, GPIO_FUNC_SPI);
+    gpio_set_function(SPI_MOSI_DISP, GPIO_FUNC_SPI);
+    boot_phase_end();
+
+    boot_phase_begin("display cfg");
+    ssd1306_init_spi(&ssd, WIDTH, HEIGHT, false, SPI_PORT_DISP, SPI_DC_DISP, SPI_CS_DISP, SPI_RST_DISP);
+    ssd1306_config(&ssd);
+    boot_phase_end();
+#else
+    // I2C e Display SSD1306
+    boot_phase_begin("display i2c");
+    i2c_init(I2C_PORT_DISP, I2C_BAUD_DISP);
+    gpio_set_function(I2C_SDA_DISP, GPIO_FUNC_I2C);
+    gpio_set_function(I2C_SCL_DISP, GPIO_FUNC_I2C);
+    gpio_pull_up(I2C_SDA_DISP);
+    gpio_pull_up(I2C_SCL_DISP);
+    boot_phase_end();
+
+    boot_phase_begin("display cfg");
+    ssd1306_init(&ssd, WIDTH, HEIGHT, false, DISPLAY_ADDRESS, I2C_PORT_DISP);
+    ssd1306_config(&ssd);
+    boot_phase_end();
+#endif
+
+    // Splash descomprimido direto no buffer; a primeira tela limpa tudo
+    boot_phase_begin("display splash");
+    asset_draw(&ssd, &asset_splash, 0, 0);
+    ssd1306_send_data(&ssd);
+    ssd1306_wait_idle(&ssd);
+    boot_phase_end();
+
+    multicore_fifo_push_blocking(BOOT_CORE1_DONE);
+
+    // Livre depois do boot: o núcleo 1 vira o supervisor quando o núcleo 0 libera
+    multicore_fifo_pop_blocking();
+    supervisor_run();
+}
+
+void on_clock_change(uint32_t sys_hz)
+{
+    (void)sys_hz;
+    // set_sys_clock_khz passa o clk_peri para o PLL USB (48 MHz): os baud rates
+    // calculados no boot (clk_peri = clk_sys) precisam ser refeitos
+    i2c_set_baudrate(I2C_PORT_BH1750, I2C_BAUD_BH1750);
+#if DISPLAY_USE_SPI
+    // Não troca o baud no meio de um quadro enviado por DMA
+    ssd1306_wait_idle(&ssd);
+    spi_set_baudrate(SPI_PORT_DISP, SPI_BAUD_DISP);
+#else
+    i2c_set_baudrate(I2C_PORT_DISP, I2C_BAUD_DISP);
+#endif
+#if I2C_TARGET_ENABLE
+    // Tempos de hold do SDA no modo alvo também derivam de clk_peri
+    i2c_set_baudrate(I2C_TARGET_PORT, I2C_TARGET_BAUD);
+#endif
+#if RS485_ENABLE
+    uart_set_baudrate(RS485_UART, RS485_BAUD);
+#endif
+    uart_set_baudrate(uart0, PICO_DEFAULT_UART_BAUD_RATE);
+    gy33_update_clock();
+    npUpdateClock();
+    buzzer_update_clock(BUZZER_PIN);
+    led_update_clock();
+}
+
+void ui_setup(void)
+{
+    ui_field_init(&field_r, "R: ", 10, 0, 56, 3, NULL, UI_DEADBAND_RGB);
+    ui_field_init(&field_g, "G: ", 10, 2, 56, 3, NULL, UI_DEADBAND_RGB);
+    ui_field_init(&field_b, "B: ", 10, 4, 56, 3, NULL, UI_DEADBAND_RGB);
+    // Desvio padrão de cada canal na janela STATS_SCREEN_SPAN, à direita,
+    // com uma casa decimal ("sd 2.4")
+    ui_field_init(&field_r_sd, "sd", 72, 0, WIDTH - 72, 4, NULL, 0);
+    ui_field_init(&field_g_sd, "sd", 72, 2, WIDTH - 72, 4, NULL, 0);
+    ui_field_init(&field_b_sd, "sd", 72, 4, WIDTH - 72, 4, NULL, 0);
+    ui_field_set_decimals(&field_r_sd, 1);
+    ui_field_set_decimals(&field_g_sd, 1);
+    ui_field_set_decimals(&field_b_sd, 1);
+    // Leitura de lux em dígitos grandes de 16 px (páginas 6-7)
+    ui_field_init(&field_lux, "Lux:", 10, 6, WIDTH - 24, 5, &font_digits16, UI_DEADBAND_LUX);
+    ui_icon_init(&icon_unit, WIDTH - 14, 7, 14, 1);
+
+    ui_label_init(&label_title, 0, 1, NULL);
+    // Fonte proporcional: "Cor Intensa Detectada" cabe numa linha
+    ui_label_init(&label_line1, 3, 2, &font_prop8);
+    ui_label_init(&label_line2, 5, 2, &font_prop8);
+    // Ícone do modo ou do alerta entre o título e as mensagens (páginas 1-2)
+    ui_icon_init(&icon_status, 0, 1, WIDTH, 2);
+}
+
+// Troca de tela: único caso de redesenho completo
+bool screen_enter(ssd1306_t *ssd, ScreenMode mode)
 {
-    ssd1306_fill(ssd, false);
-    ssd1306_draw_string(ssd, "-- CALIBRACAO --", 2, 6);
-    ssd1306_draw_string(ssd, line1, 8, 25);
-    ssd1306_draw_string(ssd, line2, 25, 45);
-    ssd1306_send_data(ssd);
+    if (mode == screen_mode)
+        return false;
+
+    clock_governor_boost();
+    ui_clear(ssd);
+    ui_field_invalidate(&field_r);
+    ui_field_invalidate(&field_g);
+    ui_field_invalidate(&field_b);
+    ui_field_invalidate(&field_lux);
+    ui_field_invalidate(&field_r_sd);
+    ui_field_invalidate(&field_g_sd);
+    ui_field_invalidate(&field_b_sd);
+    ui_label_invalidate(&label_title);
+    ui_label_invalidate(&label_line1);
+    ui_label_invalidate(&label_line2);
+    ui_icon_invalidate(&icon_status);
+    ui_icon_invalidate(&icon_unit);
+    screen_mode = mode;
+    return true;
+}
+
+void draw_cal_screen(ssd1306_t *ssd, const asset_t *icon, const char *line1, const char *line2)
+{
+    draw_message_screen(ssd, "-- CALIBRACAO --", icon, line1, line2);
 }
 
-void draw_combined_screen(ssd1306_t *ssd, uint8_t r, uint8_t g, uint8_t b, uint16_t lux)
+void draw_message_screen(ssd1306_t *ssd, const char *title, const asset_t *icon, const char *line1, const char *line2)
 {
-    ssd1306_fill(ssd, false); // Limpa a tela no início de cada desenho
+    screen_enter(ssd, SCREEN_CAL);
+    ui_label_set(ssd, &label_title, title);
+    ui_icon_set(ssd, &icon_status, icon);
+    ui_label_set(ssd, &label_line1, line1);
+    ui_label_set(ssd, &label_line2, line2);
+}
 
-    bool low_light = (lux < 20);
+void draw_combined_screen(ssd1306_t *ssd, uint8_t r, uint8_t g, uint8_t b, uint16_t lux, bool lux_ok, uint8_t drift)
+{
+    // Sem o BH1750 não há alerta de luz baixa: o campo mostra "sem dados"
+    bool low_light = lux_ok && (lux < lux_low);
     bool intense_red = (r > 200 && r > g * 2 && r > b * 2);
 
     // Verifica se há alguma condição de alerta
     if (low_light || intense_red)
     {
         // MODO DE ALERTA: A tela é dedicada apenas às mensagens.
-        ssd1306_draw_string(ssd, "--- ALERTA ---", 12, 5);
+        screen_enter(ssd, SCREEN_ALERT);
+        ui_label_set(ssd, &label_title, "--- ALERTA ---");
 
         if (low_light && intense_red)
         {
             // Mostra ambos os alertas
-            ssd1306_draw_string(ssd, "Luz Baixa", 28, 25);
-            ssd1306_draw_string(ssd, "Cor Intensa", 24, 40);
+            ui_icon_set(ssd, &icon_status, &asset_icon_alert);
+            ui_label_set(ssd, &label_line1, "Luz Baixa");
+            ui_label_set(ssd, &label_line2, "Cor Intensa");
         }
         else if (low_light)
         {
             // Mostra apenas o alerta de luz baixa
-            ssd1306_draw_string(ssd, "Luz Baixa Detectada", 4, 30);
+            ui_icon_set(ssd, &icon_status, &asset_icon_low_light);
+            ui_label_set(ssd, &label_line1, "Luz Baixa Detectada");
+            ui_label_set(ssd, &label_line2, NULL);
         }
         else
         { // intense_red deve ser verdadeiro
             // Mostra apenas o alerta de cor intensa
-            ssd1306_draw_string(ssd, "Cor Intensa Detectada", 0, 30);
+            ui_icon_set(ssd, &icon_status, &asset_icon_color);
+            ui_label_set(ssd, &label_line1, "Cor Intensa Detectada");
+            ui_label_set(ssd, &label_line2, NULL);
         }
     }
+    else if (drift)
+    {
+        // Deriva lenta apontada pelas cartas de controle
+        screen_enter(ssd, SCREEN_ALERT);
+        ui_label_set(ssd, &label_title, "--- ALERTA ---");
+        ui_icon_set(ssd, &icon_status, &asset_icon_drift);
+        ui_label_set(ssd, &label_line1, "Deriva de Cor");
+        ui_label_set(ssd, &label_line2, drift_labels[drift & 0x07]);
+    }
     else
     {
-        // MODO NORMAL: Mostra os dados dos sensores, pois não há alertas.
-        char buffer[20];
-        sprintf(buffer, "R: %d", r);
-        ssd1306_draw_string(ssd, buffer, 10, 5);
-        sprintf(buffer, "G: %d", g);
-        ssd1306_draw_string(ssd, buffer, 10, 18);
-        sprintf(buffer, "B: %d", b);
-        ssd1306_draw_string(ssd, buffer, 10, 31);
-        sprintf(buffer, "Lux: %d", lux);
-        ssd1306_draw_string(ssd, buffer, 10, 48);
+        // MODO NORMAL: cada campo só é reenviado se sair da sua zona morta.
+        screen_enter(ssd, SCREEN_NORMAL);
+        ui_field_set(ssd, &field_r, r);
+        ui_field_set(ssd, &field_g, g);
+        ui_field_set(ssd, &field_b, b);
+        ui_field_set(ssd, &field_lux, lux_ok ? lux : UI_FIELD_NONE);
+        ui_icon_set(ssd, &icon_unit, lux_ok ? &asset_unit_lux : &asset_status_missing);
+
+        ws_result_t st;
+        if (window_stats_get(&stats_r, STATS_SCREEN_SPAN, &st))
+            ui_field_set(ssd, &field_r_sd, st.stddev_x10);
+        if (window_stats_get(&stats_g, STATS_SCREEN_SPAN, &st))
+            ui_field_set(ssd, &field_g_sd, st.stddev_x10);
+        if (window_stats_get(&stats_b, STATS_SCREEN_SPAN, &st))
+            ui_field_set(ssd, &field_b_sd, st.stddev_x10);
     }
+}
 
-    ssd1306_send_data(ssd);
-}
\ No newline at end of file
+// Uma linha por canal: min/max/média/desvio nas janelas de 1 s, 10 s e 60 s
+void print_stats(void)
+{
+    static const char names[] = {'R', 'G', 'B', 'L'};
+    const window_stats_t *all[] = {&stats_r, &stats_g, &stats_b, &stats_lux};
+    for (int c = 0; c < 4; c++)
+    {
+        printf("STAT %c", names[c]);
+        for (int s = 0; s < WS_SPANS; s++)
+        {
+            ws_result_t st;
+            if (window_stats_get(all[c], s, &st))
+                printf(" | %ld %ld %ld %lu", st.min, st.max, st.mean, st.stddev);
+            else
+                printf(" | - - - -");
+        }
+        printf("\n");
+    }
+}
@@ -0,0 +1,108 @@
+// Custo por amostra e latência ao degrau dos filtros de lib/filter.c no host.
+//
+// Para cada tipo e parâmetro: ns por amostra sobre um sinal ruidoso e o
+// número de amostras até a saída cruzar 50% e 90% de um degrau. Os tempos
+// são do host (ordem relativa entre filtros, não ciclos do RP2040). Falha
+// se algum filtro não alcança o degrau ou se a mediana deixa passar um
+// pico isolado.
+
+#include <stdio.h>
+#include "filter.h"
+
+#define BENCH_SAMPLES 2000000
+#define STEP_LOW 0
+#define STEP_HIGH 1000
+#define STEP_MAX_SAMPLES 1000
+
+static int failures;
+
+static uint32_t lcg_state = 12345;
+
+static int32_t noisy_sample(void)
+{
+    lcg_state = lcg_state * 1664525u + 1013904223u;
+    return 500 + (int32_t)((lcg_state >> 24) & 0x3F) - 32;
+}
+
+static double ns_per_sample(filter_type_t type, uint8_t param)
+{
+    filter_t f;
+    filter_init(&f, type, param);
+    volatile int32_t sink = 0;
+    uint64_t t0 = time_us_64();
+    for (int i = 0; i < BENCH_SAMPLES; i++)
+        sink += filter_update(&f, noisy_sample());
+    (void)sink;
+    return (time_us_64() - t0) * 1000.0 / BENCH_SAMPLES;
+}
+
+// Amostras depois do degrau até a saída atingir 'percent' do salto (-1: nunca)
+static int step_latency(filter_type_t type, uint8_t param, int percent)
+{
+    filter_t f;
+    filter_init(&f, type, param);
+    for (int i = 0; i < FILTER_MAX_WINDOW * 4; i++)
+        filter_update(&f, STEP_LOW);
+
+    int32_t target = STEP_LOW + (STEP_HIGH - STEP_LOW) * percent / 100;
+    for (int n = 1; n <= STEP_MAX_SAMPLES; n++)
+    {
+        if (filter_update(&f, STEP_HIGH) >= target)
+            return n;
+    }
+    return -1;
+}
+
+static void bench(const char *name, filter_type_t type, uint8_t param)
+{
+    int t50 = step_latency(type, param, 50);
+    int t90 = step_latency(type, param, 90);
+    printf("  %-7s %2u  %6.1f ns/amostra  degrau 50%%: %3d  90%%: %3d amostras\n", name, param,
+           ns_per_sample(type, param), t50, t90);
+    if (t50 < 0 || t90 < 0)
+    {
+        printf("  %s %u não alcança o degrau\n", name, param);
+        failures++;
+    }
+}
+
+// Um pico isolado numa janela de 3 ou mais não aparece na saída da mediana
+static void check_median_spike(void)
+{
+    for (uint8_t w = 3; w <= FILTER_MAX_WINDOW; w += 2)
+    {
+        filter_t f;
+        filter_init(&f, FILTER_MEDIAN, w);
+        for (int i = 0; i < w; i++)
+            filter_update(&f, 100);
+        for (int i = 0; i < w; i++)
+        {
+            int32_t out = filter_update(&f, i == 0 ? 5000 : 100);
+            if (out != 100)
+            {
+                printf("  mediana %u deixou passar o pico (%ld)\n", w, (long)out);
+                failures++;
+                break;
+            }
+        }
+    }
+}
+
+int main(void)
+{
+    static const uint8_t windows[] = {3, 5, 8, 16};
+    static const uint8_t shifts[] = {1, 2, 3, 4};
+
+    printf("--- Filtros: %d amostras por medida ---\n", BENCH_SAMPLES);
+    bench("nenhum", FILTER_NONE, 0);
+    for (unsigned i = 0; i < sizeof(shifts); i++)
+        bench("ema", FILTER_EMA, shifts[i]);
+    for (unsigned i = 0; i < sizeof(windows); i++)
+        bench("boxcar", FILTER_BOXCAR, windows[i]);
+    for (unsigned i = 0; i < sizeof(windows); i++)
+        bench("mediana", FILTER_MEDIAN, windows[i]);
+    check_median_spike();
+
+    printf("filter: %s\n", failures ? "FALHOU" : "ok");
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,71 @@
+// Kernels de lib/interp_kernels.c no host (PICO_ON_DEVICE = 0: caminho C/SWAR).
+//
+// Roda o mesmo kern_benchmark do alvo e compara kern_lut/scale/blend com as
+// fórmulas por byte em todos os alfas, tamanhos 0..67 e desalinhamentos 0..3.
+
+#include <stdio.h>
+#include "interp_kernels.h"
+
+#define EQ_MAX_LEN 67
+#define EQ_MAX_OFFSET 3
+
+static int failures;
+
+static uint32_t lcg_state = 2024;
+
+static uint8_t rnd8(void)
+{
+    lcg_state = lcg_state * 1664525u + 1013904223u;
+    return lcg_state >> 24;
+}
+
+static void check_equivalence(void)
+{
+    static uint8_t lut[256];
+    static uint8_t a[EQ_MAX_LEN + EQ_MAX_OFFSET], b[EQ_MAX_LEN + EQ_MAX_OFFSET];
+    static uint8_t out[EQ_MAX_LEN + EQ_MAX_OFFSET];
+
+    for (int i = 0; i < 256; i++)
+        lut[i] = rnd8();
+    for (int i = 0; i < EQ_MAX_LEN + EQ_MAX_OFFSET; i++)
+    {
+        a[i] = rnd8();
+        b[i] = rnd8();
+    }
+    a[0] = 0;
+    b[0] = 255; // Extremos sempre presentes
+    a[1] = 255;
+    b[1] = 0;
+
+    for (size_t off = 0; off <= EQ_MAX_OFFSET; off++)
+    {
+        for (size_t n = 0; n + off <= EQ_MAX_LEN; n++)
+        {
+            kern_lut_u8(lut, a + off, out, n);
+            for (size_t i = 0; i < n; i++)
+                failures += out[i] != lut[a[off + i]];
+
+            for (int alpha = 0; alpha < 256; alpha++)
+            {
+                kern_scale_u8(a + off, out, n, alpha);
+                for (size_t i = 0; i < n; i++)
+                    failures += out[i] != (uint8_t)((a[off + i] * alpha) >> 8);
+
+                kern_blend_u8(a + off, b + off, out, n, alpha);
+                for (size_t i = 0; i < n; i++)
+                    failures += out[i] != (uint8_t)(a[off + i] + ((((int32_t)b[off + i] - a[off + i]) * alpha) >> 8));
+            }
+        }
+    }
+    if (failures)
+        printf("  %d bytes diferentes da fórmula por byte\n", failures);
+}
+
+int main(void)
+{
+    if (!kern_benchmark())
+        failures++;
+    check_equivalence();
+    printf("interp_kernels: %s\n", failures ? "FALHOU" : "ok");
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,215 @@
+// Parser de quadros do GY-33 (lib/gy33_uart.c) no host.
+//
+// Sem argumentos: alimenta o roteiro abaixo byte a byte, mais casos de
+// ressincronização. Com o caminho de um tty: lê o mesmo roteiro enviado por
+// tools/gy33_feeder.py num pseudo-terminal, em pedaços e com pausas.
+
+#include <fcntl.h>
+#include <poll.h>
+#include <stdio.h>
+#include <string.h>
+#include <termios.h>
+#include <unistd.h>
+#include "gy33_uart.h"
+
+static int failures;
+
+#define CHECK(cond)                                                       \
+    do                                                                    \
+    {                                                                     \
+        if (!(cond))                                                      \
+        {                                                                 \
+            printf("%s:%d: falhou: %s\n", __FILE__, __LINE__, #cond);     \
+            failures++;                                                   \
+        }                                                                 \
+    } while (0)
+
+typedef struct
+{
+    uint8_t type;
+    uint8_t len;
+    uint8_t data[GY33_FRAME_MAX_DATA];
+} frame_t;
+
+// Quadros válidos do roteiro, na ordem (mesmos valores de tools/gy33_feeder.py)
+static const frame_t expected[] = {
+    {GY33_FRAME_RAW, 8, {0x12, 0x34, 0x05, 0x67, 0x08, 0x9A, 0x2B, 0xCD}}, // R, G, B, C
+    {GY33_FRAME_LUX_CT, 4, {0x01, 0xF4, 0x1A, 0x0A}},                     // 500 lx, 6666 K
+    {GY33_FRAME_RGB, 3, {200, 100, 50}},
+    {GY33_FRAME_RGB, 3, {10, 20, 30}},
+};
+#define EXPECTED_FRAMES (sizeof(expected) / sizeof(expected[0]))
+#define EXPECTED_CHECKSUM_ERRORS 1
+
+static size_t put_frame(uint8_t *out, uint8_t type, const uint8_t *data, uint8_t len)
+{
+    size_t n = 0;
+    out[n++] = GY33_FRAME_HEADER;
+    out[n++] = GY33_FRAME_HEADER;
+    out[n++] = type;
+    out[n++] = len;
+    memcpy(&out[n], data, len);
+    n += len;
+    uint8_t sum = 0;
+    for (size_t i = 0; i < n; i++)
+        sum += out[i];
+    out[n++] = sum;
+    return n;
+}
+
+// Roteiro: lixo, RAW, LUX_CT com soma errada, LUX_CT, 0x5A extra + RGB, RGB
+static size_t build_script(uint8_t *out)
+{
+    static const uint8_t noise[] = {0x00, 0xFF, GY33_FRAME_HEADER, 0x00};
+    size_t n = 0;
+    memcpy(out, noise, sizeof(noise));
+    n += sizeof(noise);
+    n += put_frame(&out[n], expected[0].type, expected[0].data, expected[0].len);
+    n += put_frame(&out[n], expected[1].type, expected[1].data, expected[1].len);
+    out[n - 1]++; // Soma corrompida
+    n += put_frame(&out[n], expected[1].type, expected[1].data, expected[1].len);
+    out[n++] = GY33_FRAME_HEADER;
+    n += put_frame(&out[n], expected[2].type, expected[2].data, expected[2].len);
+    n += put_frame(&out[n], expected[3].type, expected[3].data, expected[3].len);
+    return n;
+}
+
+static frame_t decoded[EXPECTED_FRAMES + 4];
+static size_t decoded_count;
+
+static void feed(gy33_parser_t *parser, const uint8_t *bytes, size_t n)
+{
+    for (size_t i = 0; i < n; i++)
+    {
+        if (!gy33_parser_feed(parser, bytes[i]))
+            continue;
+        if (decoded_count < sizeof(decoded) / sizeof(decoded[0]))
+        {
+            frame_t *f = &decoded[decoded_count];
+            f->type = parser->type;
+            f->len = parser->len;
+            memcpy(f->data, parser->data, parser->len);
+        }
+        decoded_count++;
+    }
+}
+
+static void check_script_result(const gy33_parser_t *parser)
+{
+    CHECK(decoded_count == EXPECTED_FRAMES);
+    CHECK(parser->frames_ok == EXPECTED_FRAMES);
+    CHECK(parser->checksum_errors == EXPECTED_CHECKSUM_ERRORS);
+    for (size_t i = 0; i < EXPECTED_FRAMES && i < decoded_count; i++)
+    {
+        CHECK(decoded[i].type == expected[i].type);
+        CHECK(decoded[i].len == expected[i].len);
+        CHECK(memcmp(decoded[i].data, expected[i].data, expected[i].len) == 0);
+    }
+    if (decoded_count >= 2)
+    {
+        // Valores como o driver os monta (16 bits, MSB primeiro)
+        CHECK(((decoded[0].data[0] << 8) | decoded[0].data[1]) == 0x1234);
+        CHECK(((decoded[0].data[6] << 8) | decoded[0].data[7]) == 0x2BCD);
+        CHECK(((decoded[1].data[0] << 8) | decoded[1].data[1]) == 500);
+        CHECK(((decoded[1].data[2] << 8) | decoded[1].data[3]) == 6666);
+    }
+}
+
+static void test_script(void)
+{
+    uint8_t stream[128];
+    size_t n = build_script(stream);
+    gy33_parser_t parser;
+    gy33_parser_init(&parser);
+    decoded_count = 0;
+    feed(&parser, stream, n);
+    check_script_result(&parser);
+}
+
+static void test_resync(void)
+{
+    gy33_parser_t parser;
+    gy33_parser_init(&parser);
+    decoded_count = 0;
+
+    // Tamanho impossível descarta o cabeçalho; o quadro seguinte é aceito
+    static const uint8_t bad_len[] = {GY33_FRAME_HEADER, GY33_FRAME_HEADER, GY33_FRAME_RGB, GY33_FRAME_MAX_DATA + 1};
+    feed(&parser, bad_len, sizeof(bad_len));
+    uint8_t frame[16];
+    size_t n = put_frame(frame, expected[2].type, expected[2].data, expected[2].len);
+    feed(&parser, frame, n);
+    CHECK(decoded_count == 1);
+
+    // Qualquer bit trocado nos dados ou na soma é rejeitado
+    for (size_t byte = 4; byte < n; byte++)
+    {
+        for (int bit = 0; bit < 8; bit++)
+        {
+            uint8_t copy[16];
+            memcpy(copy, frame, n);
+            copy[byte] ^= 1u << bit;
+            decoded_count = 0;
+            feed(&parser, copy, n);
+            CHECK(decoded_count == 0);
+        }
+    }
+
+    // Depois dos erros o parser segue sincronizando normalmente
+    decoded_count = 0;
+    feed(&parser, frame, n);
+    CHECK(decoded_count == 1);
+
+    uint8_t cmd[3];
+    gy33_build_command(GY33_CMD_CONTINUOUS | GY33_OUT_RAW, cmd);
+    CHECK(cmd[0] == GY33_CMD_HEADER && cmd[1] == 0x51 && cmd[2] == 0xF6);
+}
+
+// Lê o roteiro de um tty até receber todos os quadros ou passar o prazo
+static void test_tty(const char *path)
+{
+    int fd = open(path, O_RDONLY | O_NOCTTY);
+    if (fd < 0)
+    {
+        perror(path);
+        failures++;
+        return;
+    }
+    struct termios tio;
+    if (tcgetattr(fd, &tio) == 0)
+    {
+        cfmakeraw(&tio);
+        tcsetattr(fd, TCSANOW, &tio);
+    }
+
+    gy33_parser_t parser;
+    gy33_parser_init(&parser);
+    decoded_count = 0;
+    uint64_t deadline = time_us_64() + 5000000;
+    while (decoded_count < EXPECTED_FRAMES && time_us_64() < deadline)
+    {
+        struct pollfd pfd = {.fd = fd, .events = POLLIN};
+        if (poll(&pfd, 1, 100) <= 0)
+            continue;
+        uint8_t buf[64];
+        ssize_t got = read(fd, buf, sizeof(buf));
+        if (got > 0)
+            feed(&parser, buf, (size_t)got);
+    }
+    close(fd);
+    check_script_result(&parser);
+}
+
+int main(int argc, char **argv)
+{
+    if (argc > 1)
+    {
+        test_tty(argv[1]);
+    }
+    else
+    {
+        test_script();
+        test_resync();
+    }
+    printf("gy33_parser: %s\n", failures ? "FALHOU" : "ok");
+    return failures ? 1 : 0;
+}
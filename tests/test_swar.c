@@ -0,0 +1,125 @@
+// Equivalência de lib/swar.c com as fórmulas por byte, no host.
+//
+// Palavras: todo par de bytes (a, b) em todas as pistas, para alfa 0..256.
+// Vetores: tamanhos 0..37 (cauda de 0 a 3 bytes) e desalinhamentos 0..3.
+
+#include <stdio.h>
+#include "swar.h"
+
+#define VEC_MAX_LEN 37
+#define VEC_MAX_OFFSET 3
+
+static int failures;
+
+static uint32_t lcg_state = 89;
+
+static uint8_t rnd8(void)
+{
+    lcg_state = lcg_state * 1664525u + 1013904223u;
+    return lcg_state >> 24;
+}
+
+static uint8_t ref_scale(uint8_t x, uint32_t alpha)
+{
+    return (x * alpha) >> 8;
+}
+
+static uint8_t ref_blend(uint8_t a, uint8_t b, uint32_t alpha)
+{
+    return a + ((((int32_t)b - a) * (int32_t)alpha) >> 8);
+}
+
+static uint8_t ref_add_sat(uint8_t a, uint8_t b)
+{
+    return a + b > 255 ? 255 : a + b;
+}
+
+static uint8_t lane(uint32_t w, int i)
+{
+    return w >> (8 * i);
+}
+
+static void fail(const char *what, uint32_t a, uint32_t b, uint32_t alpha)
+{
+    if (failures++ < 10)
+        printf("  %s: a=%08lx b=%08lx alpha=%lu\n", what, (unsigned long)a, (unsigned long)b, (unsigned long)alpha);
+}
+
+// Cada pista recebe um byte diferente dos dois valores, para pegar carries entre pistas
+static void check_words(void)
+{
+    for (uint32_t x = 0; x < 256; x++)
+    {
+        for (uint32_t y = 0; y < 256; y++)
+        {
+            uint32_t a = x | (y << 8) | ((255 - x) << 16) | ((x ^ y) << 24);
+            uint32_t b = y | (x << 8) | ((255 - y) << 16) | ((x + y) & 0xFF) << 24;
+
+            uint32_t sat = swar_add_sat_word(a, b);
+            for (int i = 0; i < 4; i++)
+                if (lane(sat, i) != ref_add_sat(lane(a, i), lane(b, i)))
+                    fail("add_sat_word", a, b, 0);
+
+            for (uint32_t alpha = 0; alpha <= SWAR_ALPHA_ONE; alpha++)
+            {
+                uint32_t s = swar_scale_word(a, alpha);
+                uint32_t m = swar_blend_word(a, b, alpha);
+                for (int i = 0; i < 4; i++)
+                {
+                    if (lane(s, i) != ref_scale(lane(a, i), alpha))
+                        fail("scale_word", a, 0, alpha);
+                    if (lane(m, i) != ref_blend(lane(a, i), lane(b, i), alpha))
+                        fail("blend_word", a, b, alpha);
+                }
+            }
+        }
+    }
+}
+
+static void check_vectors(void)
+{
+    static uint8_t a[VEC_MAX_LEN + VEC_MAX_OFFSET], b[VEC_MAX_LEN + VEC_MAX_OFFSET];
+    static uint8_t out[VEC_MAX_LEN + VEC_MAX_OFFSET + 1];
+
+    for (int i = 0; i < VEC_MAX_LEN + VEC_MAX_OFFSET; i++)
+    {
+        a[i] = rnd8();
+        b[i] = rnd8();
+    }
+
+    for (size_t off = 0; off <= VEC_MAX_OFFSET; off++)
+    {
+        for (size_t n = 0; n + off <= VEC_MAX_LEN; n++)
+        {
+            // Sentinela: nada é escrito depois de dst[n - 1]
+            out[n] = 0xA5;
+            swar_add_sat_u8(a + off, b + off, out, n);
+            for (size_t i = 0; i < n; i++)
+                if (out[i] != ref_add_sat(a[off + i], b[off + i]))
+                    fail("add_sat_u8", off, n, 0);
+
+            for (uint32_t alpha = 0; alpha <= SWAR_ALPHA_ONE; alpha++)
+            {
+                swar_scale_u8(a + off, out, n, alpha);
+                for (size_t i = 0; i < n; i++)
+                    if (out[i] != ref_scale(a[off + i], alpha))
+                        fail("scale_u8", off, n, alpha);
+
+                swar_blend_u8(a + off, b + off, out, n, alpha);
+                for (size_t i = 0; i < n; i++)
+                    if (out[i] != ref_blend(a[off + i], b[off + i], alpha))
+                        fail("blend_u8", off, n, alpha);
+            }
+            if (out[n] != 0xA5)
+                fail("escrita além do fim", off, n, 0);
+        }
+    }
+}
+
+int main(void)
+{
+    check_words();
+    check_vectors();
+    printf("swar: %s\n", failures ? "FALHOU" : "ok");
+    return failures ? 1 : 0;
+}
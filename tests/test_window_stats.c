@@ -0,0 +1,132 @@
+// lib/window_stats.c contra uma releitura completa das amostras, no host.
+//
+// 20k amostras com intervalos aleatórios e lacunas longas (maiores que
+// cada janela); depois de cada amostra, as três janelas são conferidas com
+// mínimo, máximo, média e desvio (inteiro e em décimos) recalculados sobre
+// os mesmos baldes.
+
+#include <stdio.h>
+#include "window_stats.h"
+
+#define TEST_SAMPLES 20000
+
+static const struct
+{
+    uint32_t bucket_ms;
+    uint32_t nbuckets;
+} layout[WS_SPANS] = {
+    [WS_1S] = {100, 10},
+    [WS_10S] = {1000, 10},
+    [WS_60S] = {5000, 12},
+};
+
+static uint32_t times[TEST_SAMPLES];
+static int32_t values[TEST_SAMPLES];
+static int failures;
+
+static uint32_t lcg_state = 91;
+
+static uint32_t rnd(uint32_t n)
+{
+    lcg_state = lcg_state * 1664525u + 1013904223u;
+    return (lcg_state >> 8) % n;
+}
+
+static uint64_t isqrt_ref(uint64_t x)
+{
+    uint64_t r = 0;
+    for (uint64_t bit = (uint64_t)1 << 31; bit; bit >>= 1)
+        if ((r + bit) * (r + bit) <= x)
+            r += bit;
+    return r;
+}
+
+// Amostras [0, last] dentro dos nbuckets baldes que terminam no da última
+static bool brute_force(ws_span_t span, int last, ws_result_t *out)
+{
+    uint32_t cur = times[last] / layout[span].bucket_ms;
+    uint32_t first = cur >= layout[span].nbuckets - 1 ? cur - (layout[span].nbuckets - 1) : 0;
+    int64_t n = 0, sum = 0, sumsq = 0;
+    int32_t min = INT32_MAX, max = INT32_MIN;
+    for (int i = last; i >= 0 && times[i] / layout[span].bucket_ms >= first; i--)
+    {
+        n++;
+        sum += values[i];
+        sumsq += (int64_t)values[i] * values[i];
+        if (values[i] < min)
+            min = values[i];
+        if (values[i] > max)
+            max = values[i];
+    }
+    if (n == 0)
+        return false;
+    int64_t spread = n * sumsq - sum * sum;
+    out->count = n;
+    out->min = min;
+    out->max = max;
+    out->mean = sum / n;
+    out->stddev = spread > 0 ? isqrt_ref(spread) / n : 0;
+    out->stddev_x10 = spread > 0 ? isqrt_ref(spread * 100) / n : 0;
+    return true;
+}
+
+static void check(const window_stats_t *ws, int last)
+{
+    static const char *const names[WS_SPANS] = {"1s", "10s", "60s"};
+    for (int s = 0; s < WS_SPANS; s++)
+    {
+        ws_result_t got = {0}, want = {0};
+        bool have = window_stats_get(ws, s, &got);
+        bool expect = brute_force(s, last, &want);
+        if (have != expect || (have && (got.count != want.count || got.min != want.min || got.max != want.max ||
+                                        got.mean != want.mean || got.stddev != want.stddev ||
+                                        got.stddev_x10 != want.stddev_x10)))
+        {
+            if (failures++ < 10)
+                printf("  amostra %d (t=%lu ms) janela %s: n %lu/%lu min %ld/%ld max %ld/%ld media %ld/%ld sd %lu/%lu sd10 %lu/%lu\n",
+                       last, (unsigned long)times[last], names[s], (unsigned long)got.count,
+                       (unsigned long)want.count, (long)got.min, (long)want.min, (long)got.max, (long)want.max,
+                       (long)got.mean, (long)want.mean, (unsigned long)got.stddev, (unsigned long)want.stddev,
+                       (unsigned long)got.stddev_x10, (unsigned long)want.stddev_x10);
+        }
+    }
+}
+
+int main(void)
+{
+    window_stats_t ws;
+    window_stats_init(&ws);
+
+    uint32_t t = 123;
+    for (int i = 0; i < TEST_SAMPLES; i++)
+    {
+        // Ritmo normal de 0-150 ms; às vezes lacunas de 2 a 80 s
+        uint32_t r = rnd(1000);
+        if (r < 3)
+            t += 2000 + rnd(78000);
+        else if (r < 10)
+            t += 200 + rnd(5000);
+        else
+            t += rnd(151);
+
+        // Sinal com deriva e ruído, incluindo negativos e extremos de 16 bits
+        int32_t v = (int32_t)rnd(2000) - 1000 + (i / 50) % 3000;
+        if (rnd(100) == 0)
+            v = rnd(2) ? 65535 : -65535;
+
+        times[i] = t;
+        values[i] = v;
+        window_stats_add(&ws, t, v);
+        check(&ws, i);
+    }
+
+    // Reset esvazia todas as janelas
+    window_stats_reset(&ws);
+    ws_result_t out;
+    for (int s = 0; s < WS_SPANS; s++)
+        if (window_stats_get(&ws, s, &out))
+            failures++;
+
+    printf("window_stats: %s\n", failures ? "FALHOU" : "ok");
+    return failures ? 1 : 0;
+}
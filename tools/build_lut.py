@@ -0,0 +1,181 @@
+#!/usr/bin/env python3
+"""
+build_lut.py - Gera a tabela 3D de correção de cor (lib/color_lut_data.c).
+
+A tabela mapeia a cor normalizada por preto/branco (0-255 por canal, a
+mesma entrada da CCM em lib/gy33.c) para a cor corrigida, numa grade de
+17x17x17 nós. Sem medidas, cada nó recebe a própria CCM de lib/gy33.c
+(a tabela reproduz a correção atual). Com medidas, o resíduo da CCM em
+cada amostra (referência - CCM(medida)) é espalhado pelos nós próximos
+com pesos gaussianos, corrigindo a resposta não linear do sensor perto
+das cores medidas e mantendo a CCM longe delas.
+
+Formato das medidas (CSV, cabeçalho opcional, uma amostra por linha):
+    r,g,b,ref_r,ref_g,ref_b
+onde r,g,b é a cor normalizada (campo "n=" das linhas TRIG do modo
+disparado) e ref_* é a cor verdadeira do padrão, em 0-255.
+
+Uso:
+    python3 tools/build_lut.py -o lib/color_lut_data.c
+    python3 tools/build_lut.py -m medidas.csv -o lib/color_lut_data.c
+"""
+
+import argparse
+import csv
+import math
+import re
+import sys
+from pathlib import Path
+
+ROOT = Path(__file__).resolve().parent.parent
+GY33_C = ROOT / "lib" / "gy33.c"
+
+NODES = 17
+STEP = 16
+
+
+def load_ccm():
+    """Lê a matriz ccm[3][3] de lib/gy33.c."""
+    text = GY33_C.read_text(encoding="utf-8")
+    block = re.search(r"ccm\[3\]\[3\]\s*=\s*\{(.*?)\};", text, re.S)
+    if not block:
+        sys.exit("ccm[3][3] não encontrada em lib/gy33.c")
+    values = [float(v) for v in re.findall(r"-?\d+\.\d+", block.group(1))]
+    if len(values) != 9:
+        sys.exit("ccm[3][3] deve ter 9 coeficientes")
+    return [values[0:3], values[3:6], values[6:9]]
+
+
+def apply_ccm(ccm, rgb):
+    """CCM seguida do mesmo limite 0-255 aplicado pelo firmware."""
+    return [max(0.0, min(255.0, sum(ccm[i][j] * rgb[j] for j in range(3)))) for i in range(3)]
+
+
+def load_measurements(path):
+    samples = []
+    with open(path, newline="", encoding="utf-8") as f:
+        for row in csv.reader(f):
+            if not row or row[0].strip().startswith("#"):
+                continue
+            try:
+                values = [float(v) for v in row[:6]]
+            except ValueError:
+                continue  # Cabeçalho
+            if len(values) == 6:
+                samples.append((values[:3], values[3:]))
+    return samples
+
+
+def node_input(i):
+    """Entrada representada pelo nó i (o nó 16 fica em 256 e vale 255)."""
+    return min(i * STEP, 255)
+
+
+def build(ccm, samples, sigma, prior):
+    residuals = [(m, [ref[c] - out[c] for c in range(3)])
+                 for m, ref in samples
+                 for out in [apply_ccm(ccm, m)]]
+    two_sigma2 = 2.0 * sigma * sigma
+    lut = []
+    for ir in range(NODES):
+        for ig in range(NODES):
+            for ib in range(NODES):
+                node = [node_input(ir), node_input(ig), node_input(ib)]
+                out = apply_ccm(ccm, node)
+                if residuals:
+                    # Média ponderada dos resíduos, puxada para zero por 'prior'
+                    acc = [0.0, 0.0, 0.0]
+                    wsum = prior
+                    for m, res in residuals:
+                        d2 = sum((node[c] - m[c]) ** 2 for c in range(3))
+                        w = math.exp(-d2 / two_sigma2)
+                        wsum += w
+                        for c in range(3):
+                            acc[c] += w * res[c]
+                    out = [out[c] + acc[c] / wsum for c in range(3)]
+                lut.append([max(0, min(255, int(round(v)))) for v in out])
+    return lut
+
+
+def lut_lookup(lut, rgb):
+    """Interpolação tetraédrica com a mesma aritmética de lib/color_lut.c."""
+    idx = [v >> 4 for v in rgb]
+    frac = [v & 15 for v in rgb]
+
+    def node(dr, dg, db):
+        return lut[((idx[0] + dr) * NODES + idx[1] + dg) * NODES + idx[2] + db]
+
+    order = sorted(range(3), key=lambda c: -frac[c])
+    step = [0, 0, 0]
+    verts = [node(0, 0, 0)]
+    for c in order:
+        step[c] = 1
+        verts.append(node(*step))
+    f = [frac[c] for c in order]
+    out = []
+    for ch in range(3):
+        acc = (verts[0][ch] * 16 + f[0] * (verts[1][ch] - verts[0][ch]) +
+               f[1] * (verts[2][ch] - verts[1][ch]) +
+               f[2] * (verts[3][ch] - verts[2][ch]))
+        out.append(max(0, min(255, (acc + 8) >> 4)))
+    return out
+
+
+def report(ccm, lut, samples):
+    def err(fn):
+        errors = [math.dist(fn(m), ref) for m, ref in samples]
+        return sum(errors) / len(errors), max(errors)
+
+    ccm_mean, ccm_max = err(lambda m: [int(x) for x in apply_ccm(ccm, m)])
+    lut_mean, lut_max = err(lambda m: lut_lookup(lut, [int(round(x)) for x in m]))
+    print(f"{len(samples)} medidas - erro RGB medio/max: CCM {ccm_mean:.1f}/{ccm_max:.1f}, "
+          f"LUT {lut_mean:.1f}/{lut_max:.1f}", file=sys.stderr)
+
+
+def emit(lut, source):
+    lines = [
+        "// Gerado por tools/build_lut.py - não editar à mão.",
+        f"// Origem: {source}",
+        "// Nós em 0, 16, ..., 240, 255 por eixo; indexado [r][g][b][canal].",
+        "",
+        '#include "color_lut.h"',
+        "",
+        "const uint8_t color_lut_data[COLOR_LUT_NODES][COLOR_LUT_NODES][COLOR_LUT_NODES][3] = {",
+    ]
+    for ir in range(NODES):
+        lines.append("    {")
+        for ig in range(NODES):
+            row = lut[(ir * NODES + ig) * NODES:(ir * NODES + ig + 1) * NODES]
+            cells = ", ".join("{%d, %d, %d}" % tuple(c) for c in row)
+            lines.append(f"        {{{cells}}},")
+        lines.append("    },")
+    lines.append("};")
+    return "\n".join(lines) + "\n"
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[1])
+    parser.add_argument("-m", "--measurements", help="CSV r,g,b,ref_r,ref_g,ref_b")
+    parser.add_argument("-o", "--output", help="arquivo de saída (padrão: stdout)")
+    parser.add_argument("--sigma", type=float, default=32.0,
+                        help="raio de influência de cada medida, em contagens (padrão 32)")
+    parser.add_argument("--prior", type=float, default=0.05,
+                        help="peso da CCM pura em cada nó (padrão 0.05)")
+    args = parser.parse_args()
+
+    ccm = load_ccm()
+    samples = load_measurements(args.measurements) if args.measurements else []
+    lut = build(ccm, samples, args.sigma, args.prior)
+    if samples:
+        report(ccm, lut, samples)
+
+    source = f"CCM de lib/gy33.c + {len(samples)} medidas" if samples else "CCM de lib/gy33.c"
+    text = emit(lut, source)
+    if args.output:
+        Path(args.output).write_text(text, encoding="utf-8")
+    else:
+        sys.stdout.write(text)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,216 @@
+#!/usr/bin/env python3
+"""
+fontgen.py - Gera fontes para o motor de fontes do SSD1306 (lib/fonts.h).
+
+Lê a fonte monoespaçada 8x8 de lib/font.h (um byte por coluna, bit 0 no topo),
+seleciona um subconjunto de caracteres, opcionalmente amplia os glifos com
+Scale2x/Scale3x (bordas suavizadas em vez de pixels duplicados), recorta as
+colunas vazias (largura proporcional), opcionalmente condensa os traços
+duplos da fonte base, e grava os glifos já rotacionados em
+ordem de página: para cada coluna, 'pages' bytes consecutivos - o mesmo
+layout do ram_buffer do display, permitindo cópia direta por coluna.
+
+Uso:
+    python3 tools/fontgen.py -o lib/fonts_data.c
+"""
+
+import argparse
+import re
+import sys
+from pathlib import Path
+
+ROOT = Path(__file__).resolve().parent.parent
+FONT_H = ROOT / "lib" / "font.h"
+
+# (nome C, caracteres, escala, largura do espaço, colunas entre glifos, condensar)
+FONTS = [
+    ("font_prop8", "".join(chr(c) for c in range(0x20, 0x7F)), 1, 3, 1, True),
+    ("font_digits16", " +-.0123456789", 2, 6, 2, False),
+    ("font_digits24", " +-.0123456789", 3, 9, 3, False),
+]
+
+
+def load_base_font():
+    """Retorna {char: [coluna0..coluna7]} a partir de lib/font.h."""
+    text = FONT_H.read_text(encoding="utf-8")
+    body = text[text.index("{") + 1:text.rindex("}")]
+    values = [int(v, 16) for v in re.findall(r"0x([0-9A-Fa-f]{2})", body)]
+    glyphs = {}
+    for i in range(len(values) // 8):
+        glyphs[chr(0x20 + i)] = values[i * 8:i * 8 + 8]
+    return glyphs
+
+
+def to_bitmap(columns):
+    """Colunas (bit 0 = topo) -> matriz [linha][coluna] de 0/1."""
+    return [[(col >> row) & 1 for col in columns] for row in range(8)]
+
+
+def scale2x(img):
+    h, w = len(img), len(img[0])
+    out = [[0] * (w * 2) for _ in range(h * 2)]
+    for y in range(h):
+        for x in range(w):
+            p = img[y][x]
+            a = img[y - 1][x] if y > 0 else 0
+            b = img[y][x + 1] if x < w - 1 else 0
+            c = img[y][x - 1] if x > 0 else 0
+            d = img[y + 1][x] if y < h - 1 else 0
+            e0 = e1 = e2 = e3 = p
+            if c == a and c != d and a != b:
+                e0 = a
+            if a == b and a != c and b != d:
+                e1 = b
+            if d == c and d != b and c != a:
+                e2 = c
+            if b == d and b != a and d != c:
+                e3 = d
+            out[2 * y][2 * x], out[2 * y][2 * x + 1] = e0, e1
+            out[2 * y + 1][2 * x], out[2 * y + 1][2 * x + 1] = e2, e3
+    return out
+
+
+def scale3x(img):
+    h, w = len(img), len(img[0])
+
+    def px(y, x):
+        return img[y][x] if 0 <= y < h and 0 <= x < w else 0
+
+    out = [[0] * (w * 3) for _ in range(h * 3)]
+    for y in range(h):
+        for x in range(w):
+            a, b, c = px(y - 1, x - 1), px(y - 1, x), px(y - 1, x + 1)
+            d, e, f = px(y, x - 1), px(y, x), px(y, x + 1)
+            g, hh, i = px(y + 1, x - 1), px(y + 1, x), px(y + 1, x + 1)
+            r = [e] * 9
+            if b != hh and d != f:
+                r[0] = d if d == b else e
+                r[1] = b if (d == b and e != c) or (b == f and e != a) else e
+                r[2] = f if b == f else e
+                r[3] = d if (d == b and e != g) or (d == hh and e != a) else e
+                r[5] = f if (b == f and e != i) or (hh == f and e != c) else e
+                r[6] = d if d == hh else e
+                r[7] = hh if (d == hh and e != i) or (hh == f and e != g) else e
+                r[8] = f if hh == f else e
+            for k in range(9):
+                out[3 * y + k // 3][3 * x + k % 3] = r[k]
+    return out
+
+
+def to_columns(img, pages):
+    """Matriz de pixels -> lista de colunas, cada uma com 'pages' bytes."""
+    h, w = len(img), len(img[0])
+    cols = []
+    for x in range(w):
+        col = []
+        for p in range(pages):
+            byte = 0
+            for bit in range(8):
+                y = p * 8 + bit
+                if y < h and img[y][x]:
+                    byte |= 1 << bit
+            col.append(byte)
+        cols.append(col)
+    return cols
+
+
+def trim(cols):
+    """Remove colunas vazias à esquerda e à direita."""
+    while cols and not any(cols[0]):
+        cols = cols[1:]
+    while cols and not any(cols[-1]):
+        cols = cols[:-1]
+    return cols
+
+
+def condense(cols):
+    """Remove colunas repetidas em sequência (a fonte base tem traços duplos)."""
+    out = []
+    for col in cols:
+        if not out or col != out[-1]:
+            out.append(col)
+    return out
+
+
+def build_font(base, name, chars, scale, space_width, spacing, condensed):
+    pages = scale
+    first, last = ord(min(chars)), ord(max(chars))
+    widths, offsets, data = [], [], []
+    for code in range(first, last + 1):
+        ch = chr(code)
+        if ch not in chars:
+            widths.append(0)
+            offsets.append(0)
+            continue
+        img = to_bitmap(base[ch])
+        if scale == 2:
+            img = scale2x(img)
+        elif scale == 3:
+            img = scale3x(img)
+        cols = trim(to_columns(img, pages))
+        if condensed:
+            cols = condense(cols)
+        if not cols:
+            cols = [[0] * pages for _ in range(space_width)]
+        widths.append(len(cols))
+        offsets.append(len(data))
+        for col in cols:
+            data.extend(col)
+    return {
+        "name": name, "first": first, "last": last, "pages": pages,
+        "spacing": spacing, "widths": widths, "offsets": offsets, "data": data,
+    }
+
+
+def emit_array(ctype, name, values, per_line=16, fmt="0x{:02X}"):
+    lines = [f"static const {ctype} {name}[] = {{"]
+    for i in range(0, len(values), per_line):
+        chunk = ", ".join(fmt.format(v) for v in values[i:i + per_line])
+        lines.append(f"    {chunk},")
+    lines.append("};")
+    return "\n".join(lines)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[1])
+    parser.add_argument("-o", "--output", help="arquivo de saída (padrão: stdout)")
+    args = parser.parse_args()
+
+    base = load_base_font()
+    out = [
+        "// Gerado por tools/fontgen.py a partir de lib/font.h - não editar à mão.",
+        "// Glifos pré-rotacionados: para cada coluna, 'pages' bytes (bit 0 no topo).",
+        "",
+        '#include "fonts.h"',
+        "",
+    ]
+    total = 0
+    for name, chars, scale, space, spacing, condensed in FONTS:
+        f = build_font(base, name, chars, scale, space, spacing, condensed)
+        total += len(f["data"])
+        out.append(emit_array("uint8_t", f"{name}_widths", f["widths"], fmt="{}"))
+        out.append("")
+        out.append(emit_array("uint16_t", f"{name}_offsets", f["offsets"], per_line=12, fmt="{}"))
+        out.append("")
+        out.append(emit_array("uint8_t", f"{name}_data", f["data"]))
+        out.append("")
+        out.append(f"const font_t {name} = {{")
+        out.append(f"    .first = 0x{f['first']:02X},")
+        out.append(f"    .last = 0x{f['last']:02X},")
+        out.append(f"    .pages = {f['pages']},")
+        out.append(f"    .spacing = {f['spacing']},")
+        out.append(f"    .widths = {name}_widths,")
+        out.append(f"    .offsets = {name}_offsets,")
+        out.append(f"    .data = {name}_data,")
+        out.append("};")
+        out.append("")
+    text = "\n".join(out)
+    if args.output:
+        Path(args.output).write_text(text, encoding="utf-8")
+    else:
+        sys.stdout.write(text)
+    sys.stderr.write(f"fontgen: {len(FONTS)} fontes, {total} bytes de glifos\n")
+
+
+if __name__ == "__main__":
+    main()
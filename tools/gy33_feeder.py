@@ -0,0 +1,104 @@
+#!/usr/bin/env python3
+"""
+gy33_feeder.py - Faz o papel do processador do GY-33 num pseudo-terminal.
+
+Envia o roteiro de quadros do teste de host (tests/test_gy33_parser.c):
+lixo antes da sincronização, um quadro RAW, um LUX_CT com soma corrompida,
+o mesmo LUX_CT byte a byte com pausas, um 0x5A extra antes de um RGB e um
+RGB partido em duas escritas. O formato dos quadros vem de lib/gy33_uart.h.
+
+Comandos:
+    --exec PROGRAMA   cria o pty, roda 'PROGRAMA <caminho do pty>', envia o
+                      roteiro uma vez e sai com o código de retorno dele
+    (sem --exec)      imprime o caminho do pty e repete o roteiro a cada
+                      --period segundos, para um leitor externo
+
+Uso:
+    python3 tools/gy33_feeder.py --exec build-tests/test_gy33_parser
+    python3 tools/gy33_feeder.py --period 0.5
+"""
+
+import argparse
+import os
+import pty
+import re
+import subprocess
+import sys
+import time
+import tty
+from pathlib import Path
+
+ROOT = Path(__file__).resolve().parent.parent
+GY33_UART_H = ROOT / "lib" / "gy33_uart.h"
+
+
+def load_protocol():
+    """Lê os #define hexadecimais de lib/gy33_uart.h."""
+    text = GY33_UART_H.read_text(encoding="utf-8")
+    return {name: int(value, 0) for name, value in re.findall(r"#define\s+(GY33_\w+)\s+(0x[0-9A-Fa-f]+|\d+)", text)}
+
+
+P = load_protocol()
+HEADER = P["GY33_FRAME_HEADER"]
+
+
+def frame(ftype, data):
+    body = bytes([HEADER, HEADER, ftype, len(data)]) + bytes(data)
+    return body + bytes([sum(body) & 0xFF])
+
+
+def script():
+    """Lista de (bytes, pausa após o envio em s). Mesmos quadros do teste em C."""
+    raw = frame(P["GY33_FRAME_RAW"], [0x12, 0x34, 0x05, 0x67, 0x08, 0x9A, 0x2B, 0xCD])
+    lux_ct = frame(P["GY33_FRAME_LUX_CT"], [0x01, 0xF4, 0x1A, 0x0A])
+    corrupt = lux_ct[:-1] + bytes([(lux_ct[-1] + 1) & 0xFF])
+    rgb1 = frame(P["GY33_FRAME_RGB"], [200, 100, 50])
+    rgb2 = frame(P["GY33_FRAME_RGB"], [10, 20, 30])
+
+    steps = [(bytes([0x00, 0xFF, HEADER, 0x00]) + raw, 0.02), (corrupt, 0.02)]
+    steps += [(bytes([b]), 0.003) for b in lux_ct]  # Byte a byte
+    steps.append((bytes([HEADER]) + rgb1, 0.02))
+    half = len(rgb2) // 2
+    steps += [(rgb2[:half], 0.05), (rgb2[half:], 0.0)]
+    return steps
+
+
+def send(fd, steps):
+    for data, pause in steps:
+        os.write(fd, data)
+        if pause:
+            time.sleep(pause)
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument("--exec", dest="program", help="leitor a rodar com o caminho do pty")
+    ap.add_argument("--period", type=float, default=1.0, help="intervalo entre roteiros sem --exec (s)")
+    args = ap.parse_args()
+
+    master, slave = pty.openpty()
+    tty.setraw(slave)
+    path = os.ttyname(slave)
+
+    if args.program:
+        child = subprocess.Popen([args.program, path])
+        time.sleep(0.2)  # Leitor abre o pty antes do primeiro byte
+        send(master, script())
+        try:
+            return child.wait(timeout=10)
+        except subprocess.TimeoutExpired:
+            child.kill()
+            print("gy33_feeder: leitor não terminou", file=sys.stderr)
+            return 1
+
+    print(path, flush=True)
+    try:
+        while True:
+            send(master, script())
+            time.sleep(args.period)
+    except KeyboardInterrupt:
+        return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
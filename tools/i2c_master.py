@@ -0,0 +1,210 @@
+#!/usr/bin/env python3
+"""
+i2c_master.py - Controlador de teste para o modo alvo I2C (lib/i2c_target.h).
+
+Faz o papel do controlador agregador a partir de um host Linux com
+/dev/i2c-N (Raspberry Pi, adaptador USB-I2C com i2c-dev) usando smbus2.
+O mapa de registradores é lido de lib/i2c_target.h, sem cópia local.
+
+Comandos:
+    poll    lê o instantâneo de uma ou mais estações periodicamente
+    test    verifica WHO_AM_I, coerência dos instantâneos (sequência e
+            tempo crescentes, leituras inteiras numa única transação) e a
+            escrita/leitura de volta da configuração
+    set     escreve um registrador de configuração (atime, lux_low)
+    cmd     envia um comando (relearn, recalibrate)
+
+Uso:
+    python3 tools/i2c_master.py --bus 1 poll 0x42 0x43
+    python3 tools/i2c_master.py test 0x42
+    python3 tools/i2c_master.py set 0x42 lux_low 50
+    python3 tools/i2c_master.py cmd 0x42 relearn
+"""
+
+import argparse
+import re
+import struct
+import sys
+import time
+from pathlib import Path
+
+ROOT = Path(__file__).resolve().parent.parent
+TARGET_H = ROOT / "lib" / "i2c_target.h"
+
+
+def load_map():
+    """Lê os #define numéricos de lib/i2c_target.h."""
+    text = TARGET_H.read_text(encoding="utf-8")
+    regs = {}
+    for name, value in re.findall(r"#define\s+(\w+)\s+(0x[0-9A-Fa-f]+|\d+)\b", text):
+        regs[name] = int(value, 0)
+    return regs
+
+
+M = load_map()
+
+
+class Bus:
+    def __init__(self, number):
+        try:
+            from smbus2 import SMBus, i2c_msg
+        except ImportError:
+            raise SystemExit("i2c_master: requer smbus2 (pip install smbus2)")
+        self.bus = SMBus(number)
+        self.msg = i2c_msg
+
+    def read(self, addr, reg, n):
+        # Endereço + RESTART + leitura: o alvo fixa um único instantâneo
+        w = self.msg.write(addr, [reg])
+        r = self.msg.read(addr, n)
+        self.bus.i2c_rdwr(w, r)
+        return bytes(r)
+
+    def write(self, addr, reg, data):
+        self.bus.i2c_rdwr(self.msg.write(addr, [reg] + list(data)))
+
+
+def decode(raw):
+    """Bytes REG_WHO_AM_I..REG_SNAPSHOT_END -> dicionário."""
+    def u16(reg):
+        return struct.unpack_from("<H", raw, reg)[0]
+
+    def u32(reg):
+        return struct.unpack_from("<I", raw, reg)[0]
+
+    return {
+        "who": raw[M["REG_WHO_AM_I"]],
+        "version": raw[M["REG_VERSION"]],
+        "valid": bool(raw[M["REG_STATUS"]] & 0x01),
+        "lux_valid": bool(raw[M["REG_STATUS"]] & 0x02),
+        "state": raw[M["REG_STATUS"]] >> 4,
+        "alerts": raw[M["REG_ALERTS"]],
+        "seq": u32(M["REG_SEQ"]),
+        "t_ms": u32(M["REG_T_MS"]),
+        "rgb": tuple(raw[M["REG_RGB"]:M["REG_RGB"] + 3]),
+        "lux": u16(M["REG_LUX"]),
+        "raw": tuple(u16(M[f"REG_RAW_{c}"]) for c in "CRGB"),
+    }
+
+
+def read_snapshot(bus, addr):
+    return decode(bus.read(addr, M["REG_WHO_AM_I"], M["REG_SNAPSHOT_END"]))
+
+
+def alerts_text(a):
+    names = [n for bit, n in ((0x01, "vermelho"), (0x02, "luz baixa"), (0x04, "deriva")) if a & bit]
+    if a & 0x70:
+        names.append("canais " + "".join(c for i, c in enumerate("RGB") if a & (0x10 << i)))
+    return ", ".join(names) or "-"
+
+
+def cmd_poll(bus, args):
+    while True:
+        for addr in args.addrs:
+            try:
+                s = read_snapshot(bus, addr)
+            except OSError as e:
+                print(f"0x{addr:02X}: sem resposta ({e})")
+                continue
+            if not s["valid"]:
+                print(f"0x{addr:02X}: sem leitura (estado {s['state']})")
+                continue
+            lux = s["lux"] if s["lux_valid"] else "--"
+            print(f"0x{addr:02X}: #{s['seq']} t={s['t_ms']} ms RGB={s['rgb']} lux={lux} "
+                  f"CRGB={s['raw']} estado={s['state']} alertas={alerts_text(s['alerts'])}")
+        if args.count == 1:
+            break
+        args.count -= 1
+        time.sleep(args.interval)
+
+
+def cmd_test(bus, args):
+    addr = args.addrs[0]
+    failures = 0
+
+    def check(ok, what):
+        nonlocal failures
+        print(("ok   " if ok else "FALHA ") + what)
+        failures += not ok
+
+    s = read_snapshot(bus, addr)
+    check(s["who"] == M["I2C_TARGET_WHO_AM_I"], f"WHO_AM_I = 0x{s['who']:02X}")
+    check(s["version"] == M["I2C_TARGET_VERSION"], f"versão {s['version']}")
+
+    # Leituras seguidas: sequência e tempo nunca voltam, mesmo com a
+    # aquisição publicando no meio das transações
+    prev, advanced, backwards = s, 0, 0
+    deadline = time.time() + args.duration
+    while time.time() < deadline:
+        s = read_snapshot(bus, addr)
+        if s["seq"] < prev["seq"] or (s["seq"] > prev["seq"] and s["t_ms"] < prev["t_ms"]):
+            backwards += 1
+        if s["seq"] == prev["seq"] and s != prev:
+            backwards += 1  # Mesmo número de sequência com conteúdo diferente: instantâneo misturado
+        advanced += s["seq"] != prev["seq"]
+        prev = s
+    check(backwards == 0, f"instantâneos coerentes ({advanced} novos em {args.duration:.0f} s)")
+    check(advanced > 0 or not s["valid"], "sequência avança com leitura válida")
+
+    # Configuração: escreve, lê de volta e restaura
+    reg = M["REG_CFG_LUX_LOW"]
+    old = bus.read(addr, reg, 2)
+    bus.write(addr, reg, struct.pack("<H", 1234))
+    time.sleep(0.1)
+    check(bus.read(addr, reg, 2) == struct.pack("<H", 1234), "escrita de lux_low")
+    bus.write(addr, reg, old)
+
+    # Registrador fora da área de configuração ignora escrita
+    bus.write(addr, M["REG_WHO_AM_I"], [0x00])
+    check(bus.read(addr, M["REG_WHO_AM_I"], 1)[0] == M["I2C_TARGET_WHO_AM_I"], "instantâneo somente leitura")
+
+    print("falhas:", failures)
+    return 1 if failures else 0
+
+
+def cmd_set(bus, args):
+    addr = args.addrs[0]
+    if args.name == "atime":
+        bus.write(addr, M["REG_CFG_ATIME"], [args.value & 0xFF])
+        time.sleep(0.1)
+        print(f"ATIME aplicado: 0x{bus.read(addr, M['REG_CFG_ATIME'], 1)[0]:02X}")
+    else:
+        bus.write(addr, M["REG_CFG_LUX_LOW"], struct.pack("<H", args.value))
+
+
+def cmd_cmd(bus, args):
+    code = {"relearn": M["I2C_TARGET_CMD_RELEARN"], "recalibrate": M["I2C_TARGET_CMD_RECALIBRATE"]}
+    bus.write(args.addrs[0], M["REG_CFG_CMD"], [code[args.name]])
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[1])
+    parser.add_argument("--bus", type=int, default=1, help="número de /dev/i2c-N")
+    sub = parser.add_subparsers(dest="command", required=True)
+
+    p = sub.add_parser("poll")
+    p.add_argument("addrs", nargs="+", type=lambda v: int(v, 0))
+    p.add_argument("--interval", type=float, default=0.5)
+    p.add_argument("--count", type=int, default=0, help="0 = sem fim")
+
+    p = sub.add_parser("test")
+    p.add_argument("addrs", nargs=1, type=lambda v: int(v, 0))
+    p.add_argument("--duration", type=float, default=5.0)
+
+    p = sub.add_parser("set")
+    p.add_argument("addrs", nargs=1, type=lambda v: int(v, 0))
+    p.add_argument("name", choices=["atime", "lux_low"])
+    p.add_argument("value", type=lambda v: int(v, 0))
+
+    p = sub.add_parser("cmd")
+    p.add_argument("addrs", nargs=1, type=lambda v: int(v, 0))
+    p.add_argument("name", choices=["relearn", "recalibrate"])
+
+    args = parser.parse_args()
+    bus = Bus(args.bus)
+    handler = {"poll": cmd_poll, "test": cmd_test, "set": cmd_set, "cmd": cmd_cmd}[args.command]
+    sys.exit(handler(bus, args) or 0)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,192 @@
+#!/usr/bin/env python3
+"""
+img2asset.py - Converte imagens monocromáticas em assets do display (lib/assets_data.c).
+
+Lê cada imagem de assets/ (PBM P1/P4 e, com Pillow instalado, PNG), grava os
+pixels em bytes de página (8 linhas por byte, bit 0 no topo), uma página
+inteira após a outra - o formato de ssd1306_draw_bitmap - e comprime o fluxo
+com RLE do tipo PackBits:
+
+    n = 0..127    -> n + 1 bytes literais a seguir
+    n = 128..255  -> o próximo byte repetido n - 126 vezes (2..129)
+
+Em ordem de página, áreas lisas e traços horizontais viram corridas longas.
+Se a versão comprimida não for menor, o asset é gravado cru. O decodificador
+(lib/assets.c) escreve o fluxo direto nas páginas do ram_buffer.
+
+Convenção de cor: pixel 1 no PBM (preto) acende no display. Em PNG, pixels
+escuros e opacos acendem.
+
+Uso:
+    python3 tools/img2asset.py -o lib/assets_data.c
+    python3 tools/img2asset.py -i assets -o lib/assets_data.c
+"""
+
+import argparse
+import re
+import sys
+from pathlib import Path
+
+ROOT = Path(__file__).resolve().parent.parent
+ASSETS_DIR = ROOT / "assets"
+
+
+def read_pbm(path):
+    """Retorna a matriz [linha][coluna] de 0/1 de um PBM (P1 ou P4)."""
+    data = path.read_bytes()
+    magic = data[:2]
+    if magic not in (b"P1", b"P4"):
+        raise ValueError(f"{path}: não é PBM")
+    # Cabeçalho: magic, largura, altura (comentários com '#')
+    tokens, pos = [], 2
+    while len(tokens) < 2:
+        m = re.compile(rb"\s*(#[^\n]*\n\s*)*(\d+)").match(data, pos)
+        if not m:
+            raise ValueError(f"{path}: cabeçalho inválido")
+        tokens.append(int(m.group(2)))
+        pos = m.end()
+    width, height = tokens
+    if magic == b"P1":
+        body = re.sub(rb"#[^\n]*", b"", data[pos:])
+        bits = [int(c) for c in body.decode("ascii") if c in "01"]
+        if len(bits) < width * height:
+            raise ValueError(f"{path}: faltam pixels")
+        return [bits[y * width:(y + 1) * width] for y in range(height)]
+    pos += 1  # Um único espaço separa o cabeçalho dos dados binários
+    stride = (width + 7) // 8
+    img = []
+    for y in range(height):
+        row = data[pos + y * stride:pos + (y + 1) * stride]
+        img.append([(row[x // 8] >> (7 - x % 8)) & 1 for x in range(width)])
+    return img
+
+
+def read_png(path):
+    try:
+        from PIL import Image
+    except ImportError:
+        raise SystemExit(f"img2asset: {path.name} requer Pillow (pip install pillow)")
+    im = Image.open(path).convert("LA")
+    width, height = im.size
+    px = im.load()
+    return [[1 if px[x, y][1] >= 128 and px[x, y][0] < 128 else 0
+             for x in range(width)] for y in range(height)]
+
+
+def to_pages(img):
+    """Matriz de pixels -> bytes página a página ('width' bytes por página)."""
+    height, width = len(img), len(img[0])
+    pages = (height + 7) // 8
+    out = []
+    for p in range(pages):
+        for x in range(width):
+            byte = 0
+            for bit in range(8):
+                y = p * 8 + bit
+                if y < height and img[y][x]:
+                    byte |= 1 << bit
+            out.append(byte)
+    return width, pages, out
+
+
+def rle_encode(data):
+    """PackBits: corridas de 2+ bytes iguais, literais de até 128 bytes."""
+    out, literal, i = [], [], 0
+
+    def flush():
+        while literal:
+            chunk = literal[:128]
+            out.append(len(chunk) - 1)
+            out.extend(chunk)
+            del literal[:128]
+
+    while i < len(data):
+        run = 1
+        while i + run < len(data) and data[i + run] == data[i] and run < 129:
+            run += 1
+        if run >= 2:
+            flush()
+            out.extend((run + 126, data[i]))
+            i += run
+        else:
+            literal.append(data[i])
+            i += 1
+    flush()
+    return out
+
+
+def rle_decode(packed):
+    out, i = [], 0
+    while i < len(packed):
+        n = packed[i]
+        if n < 128:
+            out.extend(packed[i + 1:i + 2 + n])
+            i += 2 + n
+        else:
+            out.extend([packed[i + 1]] * (n - 126))
+            i += 2
+    return out
+
+
+def emit_array(name, values, per_line=16):
+    lines = [f"static const uint8_t {name}[] = {{"]
+    for i in range(0, len(values), per_line):
+        chunk = ", ".join(f"0x{v:02X}" for v in values[i:i + per_line])
+        lines.append(f"    {chunk},")
+    lines.append("};")
+    return "\n".join(lines)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[1])
+    parser.add_argument("-i", "--input", default=str(ASSETS_DIR), help="diretório das imagens")
+    parser.add_argument("-o", "--output", help="arquivo de saída (padrão: stdout)")
+    args = parser.parse_args()
+
+    sources = sorted(p for p in Path(args.input).iterdir() if p.suffix.lower() in (".pbm", ".png"))
+    if not sources:
+        raise SystemExit(f"img2asset: nenhuma imagem em {args.input}")
+
+    out = [
+        "// Gerado por tools/img2asset.py a partir de assets/ - não editar à mão.",
+        "// Bytes de página ('width' bytes por página, bit 0 no topo), RLE PackBits.",
+        "",
+        '#include "assets.h"',
+        "",
+    ]
+    total_raw = total_packed = 0
+    for path in sources:
+        img = read_png(path) if path.suffix.lower() == ".png" else read_pbm(path)
+        width, pages, raw = to_pages(img)
+        if width > 255 or pages > 255:
+            raise SystemExit(f"img2asset: {path.name} grande demais")
+        packed = rle_encode(raw)
+        assert rle_decode(packed) == raw
+        rle = len(packed) < len(raw)
+        data = packed if rle else raw
+        name = "asset_" + re.sub(r"\W", "_", path.stem)
+        total_raw += len(raw)
+        total_packed += len(data)
+
+        out.append(f"// {path.name}: {width}x{len(img)}, {len(raw)} -> {len(data)} bytes")
+        out.append(emit_array(f"{name}_data", data))
+        out.append("")
+        out.append(f"const asset_t {name} = {{")
+        out.append(f"    .width = {width},")
+        out.append(f"    .pages = {pages},")
+        out.append(f"    .flags = {'ASSET_RLE' if rle else '0'},")
+        out.append(f"    .size = {len(data)},")
+        out.append(f"    .data = {name}_data,")
+        out.append("};")
+        out.append("")
+
+    text = "\n".join(out)
+    if args.output:
+        Path(args.output).write_text(text, encoding="utf-8")
+    else:
+        sys.stdout.write(text)
+    sys.stderr.write(f"img2asset: {len(sources)} assets, {total_raw} -> {total_packed} bytes\n")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,473 @@
+#!/usr/bin/env python3
+"""
+rs485_sim.py - Coletor e simulador de nós do barramento RS-485 (lib/rs485.h).
+
+O protocolo (comandos, tamanhos, formato dos registros) é lido de
+lib/rs485.h, sem cópia local. Os nós simulados reproduzem o firmware: fila
+de registros com confirmação, resposta após RS485_TURNAROUND_US, janela por
+slot no SLOT_READ e incerteza de até RS485_POLL_US na detecção do quadro.
+O envio é limitado ao baud configurado, então o tempo de barramento é o de
+um par RS-485 real; duas respostas que se sobrepõem viram colisão (bytes
+corrompidos), como no fio.
+
+Comandos:
+    nodes     cria um pseudo-terminal e serve N nós nele (para um coletor
+              externo ou o 'collect' em outro terminal)
+    collect   coletor: lê os nós de uma porta serial real ou de um pty
+    bench     nós e coletor no mesmo processo: compara a vazão do polling
+              unicast (um READ por nó) com o SLOT_READ em broadcast
+
+Uso:
+    python3 tools/rs485_sim.py nodes -n 8
+    python3 tools/rs485_sim.py collect --port /dev/ttyUSB0 1 2 3
+    python3 tools/rs485_sim.py bench -n 12 --duration 10 --error-rate 1e-4
+"""
+
+import argparse
+import os
+import random
+import re
+import select
+import struct
+import sys
+import termios
+import threading
+import time
+import tty
+from pathlib import Path
+
+ROOT = Path(__file__).resolve().parent.parent
+RS485_H = ROOT / "lib" / "rs485.h"
+
+
+def load_protocol():
+    """Lê os #define numéricos de lib/rs485.h (resolvendo expressões simples)."""
+    text = RS485_H.read_text(encoding="utf-8")
+    defs = {}
+    for name, value in re.findall(r"#define\s+(RS485_\w+)\s+(.+)", text):
+        expr = value.split("//")[0].strip()
+        for known in sorted(defs, key=len, reverse=True):
+            expr = expr.replace(known, str(defs[known]))
+        try:
+            defs[name] = int(eval(expr.replace("/", "//"), {}))
+        except (SyntaxError, NameError):
+            pass
+    return defs
+
+
+P = load_protocol()
+SYNC = P["RS485_SYNC"]
+HEADER = P["RS485_HEADER_SIZE"]
+CRC_SIZE = P["RS485_CRC_SIZE"]
+RECORD = struct.Struct("<IBBBBHH")
+assert RECORD.size == P["RS485_RECORD_SIZE"], "formato do registro diverge de lib/rs485.h"
+
+
+def crc16(data):
+    """CRC-16/CCITT-FALSE, igual a rs485_crc16()."""
+    crc = 0xFFFF
+    for byte in data:
+        crc ^= byte << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) if crc & 0x8000 else crc << 1
+            crc &= 0xFFFF
+    return crc
+
+
+def frame(dst, src, cmd, payload=b""):
+    body = bytes([dst, src, cmd, len(payload)]) + bytes(payload)
+    return bytes([SYNC]) + body + struct.pack("<H", crc16(body))
+
+
+class Parser:
+    """Mesma máquina de estados do firmware: SYNC, cabeçalho, payload, CRC."""
+
+    def __init__(self):
+        self.buf = bytearray()
+        self.crc_errors = 0
+
+    def feed(self, data):
+        frames = []
+        for byte in data:
+            if not self.buf and byte != SYNC:
+                continue
+            self.buf.append(byte)
+            if len(self.buf) < HEADER:
+                continue
+            length = self.buf[4]
+            if length > P["RS485_MAX_PAYLOAD"]:
+                self.buf.clear()
+                continue
+            if len(self.buf) < HEADER + length + CRC_SIZE:
+                continue
+            crc = struct.unpack_from("<H", self.buf, HEADER + length)[0]
+            if crc == crc16(self.buf[1:HEADER + length]):
+                dst, src, cmd = self.buf[1], self.buf[2], self.buf[3]
+                frames.append((dst, src, cmd, bytes(self.buf[HEADER:HEADER + length])))
+            else:
+                self.crc_errors += 1
+            self.buf.clear()
+        return frames
+
+    def reset(self):
+        """Silêncio no meio de um quadro: descarta (equivale ao timeout do nó)."""
+        partial = bool(self.buf)
+        self.buf.clear()
+        return partial
+
+
+def char_s(baud):
+    return 10.0 / baud
+
+
+def open_raw(path, baud=None):
+    fd = os.open(path, os.O_RDWR | os.O_NOCTTY)
+    tty.setraw(fd)
+    if baud:
+        attrs = termios.tcgetattr(fd)
+        speed = getattr(termios, f"B{baud}", None)
+        if speed is None:
+            raise SystemExit(f"rs485_sim: baud {baud} não suportado pelo termios")
+        attrs[4] = attrs[5] = speed
+        termios.tcsetattr(fd, termios.TCSANOW, attrs)
+    return fd
+
+
+# ---------------------------------------------------------------------------
+# Nós simulados
+
+
+class Node:
+    def __init__(self, addr, rate):
+        self.addr = addr
+        self.period = 1.0 / rate if rate > 0 else None
+        self.next_t = time.monotonic()
+        self.ring = {}
+        self.head = 0
+        self.tail = 0
+        self.dropped = 0
+
+    def produce(self, now):
+        while self.period and now >= self.next_t:
+            if self.head - self.tail >= P["RS485_RING_SIZE"]:
+                self.dropped += 1
+            else:
+                t_ms = int(self.next_t * 1000) & 0xFFFFFFFF
+                rgb = [random.randrange(256) for _ in range(3)]
+                self.ring[self.head] = (t_ms, *rgb, 0, random.randrange(2000), random.randrange(65536))
+                self.head += 1
+            self.next_t += self.period
+
+    def ack(self, ack):
+        if 0 <= ack - self.tail <= self.head - self.tail:
+            for seq in range(self.tail, ack):
+                self.ring.pop(seq, None)
+            self.tail = ack
+
+    def batch(self, max_records):
+        n = min(max_records, P["RS485_MAX_RECORDS"], self.head - self.tail)
+        out = struct.pack("<IB", self.tail & 0xFFFFFFFF, n)
+        for seq in range(self.tail, self.tail + n):
+            out += RECORD.pack(*self.ring[seq])
+        return out
+
+    def handle(self, dst, cmd, payload):
+        """Retorna (atraso em s, quadro de resposta) ou None."""
+        turnaround = P["RS485_TURNAROUND_US"] * 1e-6
+        jitter = random.uniform(0, P["RS485_POLL_US"] * 1e-6)
+        if cmd == P["RS485_CMD_PING"] and dst == self.addr:
+            body = struct.pack("<BHII", P["RS485_VERSION"], self.head - self.tail, self.head, self.dropped)
+            return turnaround + jitter, frame(0, self.addr, cmd | P["RS485_RSP_FLAG"], body)
+        if cmd == P["RS485_CMD_READ"] and dst == self.addr and len(payload) >= 5:
+            ack, max_records = struct.unpack_from("<IB", payload)
+            self.ack(ack)
+            return turnaround + jitter, frame(0, self.addr, cmd | P["RS485_RSP_FLAG"], self.batch(max_records))
+        if cmd == P["RS485_CMD_SLOT_READ"] and dst == P["RS485_BROADCAST"] and len(payload) >= 5:
+            slot_us, max_records, first, count = struct.unpack_from("<HBBB", payload)
+            slot = self.addr - first
+            if 0 <= slot < count and len(payload) >= 5 + 4 * (slot + 1):
+                self.ack(struct.unpack_from("<I", payload, 5 + 4 * slot)[0])
+                delay = turnaround + slot * slot_us * 1e-6 + jitter
+                return delay, frame(0, self.addr, cmd | P["RS485_RSP_FLAG"], self.batch(max_records))
+        return None
+
+
+class NodeBus(threading.Thread):
+    """N nós atrás de um mesmo fd; envia cada resposta limitada ao baud."""
+
+    def __init__(self, fd, count, rate, baud, error_rate, first_addr=1):
+        super().__init__(daemon=True)
+        self.fd = fd
+        self.nodes = [Node(first_addr + i, rate) for i in range(count)]
+        self.baud = baud
+        self.error_rate = error_rate
+        self.collisions = 0
+        self.stop = threading.Event()
+
+    def corrupt(self, data):
+        data = bytearray(data)
+        for i in range(len(data)):
+            if random.random() < self.error_rate:
+                data[i] ^= 1 << random.randrange(8)
+        return bytes(data)
+
+    def transmit(self, replies, t0):
+        # Respostas ordenadas pelo início; sobreposição no fio = colisão
+        replies.sort()
+        bus_free = t0
+        for i, (start, data) in enumerate(replies):
+            end = max(start, bus_free) + len(data) * char_s(self.baud)
+            nxt = replies[i + 1][0] if i + 1 < len(replies) else None
+            if start < bus_free or (nxt is not None and nxt < end):
+                self.collisions += 1
+                data = bytes(b ^ 0x5A for b in data)
+            delay = max(start, bus_free) - time.monotonic()
+            if delay > 0:
+                time.sleep(delay)
+            os.write(self.fd, self.corrupt(data))
+            bus_free = end
+            time.sleep(max(0.0, end - time.monotonic()))
+
+    def run(self):
+        parser = Parser()
+        while not self.stop.is_set():
+            now = time.monotonic()
+            for node in self.nodes:
+                node.produce(now)
+            ready, _, _ = select.select([self.fd], [], [], 0.001)
+            if not ready:
+                parser.reset()
+                continue
+            try:
+                data = os.read(self.fd, 4096)
+            except OSError:
+                break
+            for dst, _src, cmd, payload in parser.feed(data):
+                if cmd & P["RS485_RSP_FLAG"]:
+                    continue
+                t0 = time.monotonic()
+                replies = []
+                for node in self.nodes:
+                    r = node.handle(dst, cmd, payload)
+                    if r:
+                        replies.append((t0 + r[0], r[1]))
+                self.transmit(replies, t0)
+
+
+# ---------------------------------------------------------------------------
+# Coletor
+
+
+class Collector:
+    def __init__(self, fd, addrs, baud, max_records):
+        self.fd = fd
+        self.addrs = list(addrs)
+        self.baud = baud
+        self.max = max_records
+        self.parser = Parser()
+        self.ack = {a: 0 for a in self.addrs}
+        self.records = {a: 0 for a in self.addrs}
+        self.gaps = 0
+        self.dups = 0
+        self.timeouts = 0
+        self.requests = 0
+        self.tx_bytes = 0
+        self.rx_bytes = 0
+
+    def reply_s(self, n_records):
+        size = HEADER + P["RS485_BATCH_HEADER"] + n_records * P["RS485_RECORD_SIZE"] + CRC_SIZE
+        return size * char_s(self.baud)
+
+    def slot_us(self):
+        # Resposta máxima + incerteza do polling do nó + guarda de 2 caracteres
+        return int((self.reply_s(self.max) + 2 * char_s(self.baud)) * 1e6) + P["RS485_POLL_US"]
+
+    def send(self, data):
+        self.requests += 1
+        self.tx_bytes += len(data)
+        os.write(self.fd, data)
+        time.sleep(len(data) * char_s(self.baud))
+
+    def receive(self, deadline, expected):
+        got = []
+        while len(got) < expected:
+            left = deadline - time.monotonic()
+            if left <= 0:
+                break
+            ready, _, _ = select.select([self.fd], [], [], left)
+            if not ready:
+                break
+            data = os.read(self.fd, 4096)
+            self.rx_bytes += len(data)
+            got += [f for f in self.parser.feed(data) if f[0] == 0 and f[2] & P["RS485_RSP_FLAG"]]
+        self.parser.reset()
+        return got
+
+    def accept(self, src, payload):
+        if src not in self.ack or len(payload) < P["RS485_BATCH_HEADER"]:
+            return []
+        first, n = struct.unpack_from("<IB", payload)
+        expected = self.ack[src]
+        if first > expected:
+            self.gaps += first - expected
+        skip = max(0, expected - first)
+        self.dups += min(skip, n)
+        out = []
+        for i in range(skip, n):
+            off = P["RS485_BATCH_HEADER"] + i * RECORD.size
+            out.append((first + i, RECORD.unpack_from(payload, off)))
+        self.records[src] += len(out)
+        self.ack[src] = max(expected, first + n)
+        return out
+
+    def poll_unicast(self):
+        out = []
+        timeout = (P["RS485_TURNAROUND_US"] + P["RS485_POLL_US"]) * 1e-6 + self.reply_s(self.max) + 0.005
+        for addr in self.addrs:
+            self.send(frame(addr, 0, P["RS485_CMD_READ"], struct.pack("<IB", self.ack[addr], self.max)))
+            replies = self.receive(time.monotonic() + timeout, 1)
+            if not replies:
+                self.timeouts += 1
+            for _dst, src, _cmd, payload in replies:
+                out += [(src, seq, rec) for seq, rec in self.accept(src, payload)]
+        return out
+
+    def poll_slots(self):
+        first = min(self.addrs)
+        count = max(self.addrs) - first + 1
+        slot_us = self.slot_us()
+        acks = b"".join(struct.pack("<I", self.ack.get(first + i, 0)) for i in range(count))
+        payload = struct.pack("<HBBB", slot_us, self.max, first, count) + acks
+        self.send(frame(P["RS485_BROADCAST"], 0, P["RS485_CMD_SLOT_READ"], payload))
+        window = (P["RS485_TURNAROUND_US"] + count * slot_us) * 1e-6 + 0.005
+        replies = self.receive(time.monotonic() + window, len(self.addrs))
+        self.timeouts += len(self.addrs) - len(replies)
+        out = []
+        for _dst, src, _cmd, payload in replies:
+            out += [(src, seq, rec) for seq, rec in self.accept(src, payload)]
+        return out
+
+    def ping(self, addr):
+        self.send(frame(addr, 0, P["RS485_CMD_PING"]))
+        timeout = (P["RS485_TURNAROUND_US"] + P["RS485_POLL_US"]) * 1e-6 + 0.01
+        for _dst, src, _cmd, payload in self.receive(time.monotonic() + timeout, 1):
+            if src == addr and len(payload) >= 11:
+                return struct.unpack_from("<BHII", payload)
+        return None
+
+
+# ---------------------------------------------------------------------------
+# Comandos
+
+
+def cmd_nodes(args):
+    master, slave = os.openpty()
+    tty.setraw(master)
+    print(f"{args.n} nós em {os.ttyname(slave)} ({args.baud} baud, {args.rate} registros/s por nó)")
+    bus = NodeBus(master, args.n, args.rate, args.baud, args.error_rate)
+    bus.start()
+    try:
+        while True:
+            time.sleep(5)
+            pending = sum(n.head - n.tail for n in bus.nodes)
+            dropped = sum(n.dropped for n in bus.nodes)
+            print(f"pendentes {pending}, perdidos {dropped}, colisões {bus.collisions}")
+    except KeyboardInterrupt:
+        return 0
+
+
+def cmd_collect(args):
+    fd = open_raw(args.port, None if args.port.startswith("/dev/pts/") else args.baud)
+    col = Collector(fd, args.addrs, args.baud, args.max)
+    for addr in args.addrs:
+        info = col.ping(addr)
+        print(f"no {addr}: " + (f"versão {info[0]}, {info[1]} pendentes, seq {info[2]}, {info[3]} perdidos"
+                                if info else "sem resposta"))
+        if info:
+            col.ack[addr] = info[2] - info[1]
+    poll = col.poll_slots if args.slots else col.poll_unicast
+    try:
+        while True:
+            for src, seq, rec in poll():
+                t_ms, r, g, b, alerts, lux, clear = rec
+                lux = "--" if lux == P["RS485_LUX_NONE"] else lux
+                print(f"no {src} #{seq} t={t_ms} ms RGB=({r},{g},{b}) lux={lux} C={clear} alertas=0x{alerts:02X}")
+            time.sleep(args.interval)
+    except KeyboardInterrupt:
+        print(f"CRC {col.parser.crc_errors}, sem resposta {col.timeouts}, lacunas {col.gaps}, repetidos {col.dups}")
+        return 0
+
+
+def bench_mode(args, slots):
+    master, slave = os.openpty()
+    tty.setraw(master)
+    tty.setraw(slave)
+    bus = NodeBus(master, args.n, args.rate, args.baud, args.error_rate)
+    col = Collector(slave, range(1, args.n + 1), args.baud, args.max)
+    bus.start()
+    poll = col.poll_slots if slots else col.poll_unicast
+    t0 = time.monotonic()
+    cycles = 0
+    while time.monotonic() - t0 < args.duration:
+        poll()
+        cycles += 1
+    elapsed = time.monotonic() - t0
+    bus.stop.set()
+    bus.join()
+    os.close(master)
+    os.close(slave)
+
+    total = sum(col.records.values())
+    pending = sum(n.head - n.tail for n in bus.nodes)
+    dropped = sum(n.dropped for n in bus.nodes)
+    bus_s = (col.tx_bytes + col.rx_bytes) * char_s(args.baud)
+    name = "slots" if slots else "unicast"
+    print(f"{name:8s} {total / elapsed:8.0f} reg/s  {cycles / elapsed:6.1f} ciclos/s  "
+          f"ocupação {100 * bus_s / elapsed:5.1f}%  CRC {col.parser.crc_errors}  "
+          f"sem resposta {col.timeouts}  colisões {bus.collisions}  lacunas {col.gaps}  "
+          f"repetidos {col.dups}  pendentes {pending}  perdidos {dropped}")
+    return col.gaps == 0 and dropped == 0
+
+
+def cmd_bench(args):
+    if args.n > 254:
+        raise SystemExit("rs485_sim: no máximo 254 nós")
+    slot_list = {"unicast": [False], "slots": [True], "both": [False, True]}[args.mode]
+    print(f"{args.n} nós, {args.baud} baud, {args.rate} reg/s por nó, lote máx. {args.max}, "
+          f"erro por byte {args.error_rate:g}, {args.duration:.0f} s por modo")
+    ok = all([bench_mode(args, slots) for slots in slot_list])
+    return 0 if ok else 1
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[1])
+    parser.add_argument("--baud", type=int, default=460800)
+    sub = parser.add_subparsers(dest="command", required=True)
+
+    p = sub.add_parser("nodes")
+    p.add_argument("-n", type=int, default=4, help="número de nós (endereços 1..n)")
+    p.add_argument("--rate", type=float, default=50.0, help="registros/s por nó")
+    p.add_argument("--error-rate", type=float, default=0.0, help="probabilidade de erro por byte")
+
+    p = sub.add_parser("collect")
+    p.add_argument("addrs", nargs="+", type=int)
+    p.add_argument("--port", required=True)
+    p.add_argument("--slots", action="store_true", help="SLOT_READ em broadcast em vez de READ por nó")
+    p.add_argument("--max", type=int, default=P["RS485_MAX_RECORDS"], help="registros por lote")
+    p.add_argument("--interval", type=float, default=0.05)
+
+    p = sub.add_parser("bench")
+    p.add_argument("-n", type=int, default=12)
+    p.add_argument("--rate", type=float, default=50.0)
+    p.add_argument("--error-rate", type=float, default=0.0)
+    p.add_argument("--max", type=int, default=P["RS485_MAX_RECORDS"])
+    p.add_argument("--duration", type=float, default=10.0)
+    p.add_argument("--mode", choices=["unicast", "slots", "both"], default="both")
+
+    args = parser.parse_args()
+    handler = {"nodes": cmd_nodes, "collect": cmd_collect, "bench": cmd_bench}[args.command]
+    sys.exit(handler(args) or 0)
+
+
+if __name__ == "__main__":
+    main()